@@ -35,26 +35,63 @@
 #define kMidiTxPin 3   /**< the output pin for the MIDI data (not used) */
 #define kButtonPin 4   /**< the input pin for the hardware switch */
 
+#ifdef USBSerial
+static TraceRing<128> trace; /**< the binary trace of the DMX changes, decoded via tracedecoder */
+#endif
+
 /**
  * @brief Implementation of the callback mididmxbridge::dmx::DmxOnChangeCallback.
  *
  * This callback is always called as soon as a new DMX date is generated from a
  * MIDI CC signal.
  *
- * @param[in] channel the DMX channel in the range [1, 255]
+ * @param[in] channel the DMX channel in the range [1, 512]
  * @param[in] value the DMX value in the range [1, 255]
  */
-static void onDmxChange(const uint8_t channel, const uint8_t value) {
+static void onDmxChange(const uint16_t channel, const uint8_t value) {
   DMXSerial.write(channel, value);
 
 #ifdef USBSerial
-  String msg = "DMX channel / value: [" + String(channel) + " | " + String(value) + "]";
-  Serial.println(msg);
+  trace.record(millis(), channel, value);
 #endif
 }
 
+#if defined(USBSerial) && MIDIDMXBRIDGE_STATS
+#define kStatsIntervalMs 1000 /**< the interval of the statistics trace in ms */
+
+/**
+ * @brief Print the runtime statistics of the MidiDmxBridge on the serial monitor.
+ *
+ * The statistics are only available if the library is compiled with MIDIDMXBRIDGE_STATS=1, e.g.
+ * via the build property compiler.cpp.extra_flags. The text lines are skipped by the tracedecoder
+ * tool, i.e. they can be interleaved with the binary trace.
+ *
+ * @param[in] bridge the MidiDmxBridge object to trace
+ */
+static void printStats(MidiDmxBridge& bridge) {
+  static uint32_t lastPrint = 0;
+  const uint32_t now = millis();
+
+  if ((now - lastPrint) >= kStatsIntervalMs) {
+    const MidiDmxBridgeStats stats = bridge.stats();
+    const uint32_t values[] = {stats.messages,  stats.droppedBytes, stats.resyncs,  stats.overflows,
+                               stats.callbacks, stats.maxLoopUs,    stats.avgLoopUs};
+
+    Serial.print("stats msg/drop/resync/ovf/cb/max_us/avg_us:");
+    for (const uint32_t value : values) {
+      Serial.print(' ');
+      Serial.print(value);
+    }
+    Serial.println();
+    bridge.resetStats();
+    lastPrint = now;
+  }
+}
+#endif
+
 static SerialReaderDefault reader(kMidiRxPin, kMidiTxPin); /**< the serial reader receiving MIDI */
 static MidiDmxBridge MDXBridge(kMidiChannel, onDmxChange, reader); /**< the MidiDmxBridge object */
+static SceneStoreEeprom sceneStore; /**< the EEPROM restoring the scenes after a power cycle */
 
 /**
  * @brief Setup the Arduino board.
@@ -70,17 +107,19 @@ void setup() {
   pinMode(kButtonPin, INPUT);
   pinMode(LED_BUILTIN, OUTPUT);
 
-  uint8_t r[6] = {1, 4, 7, 10, 16, 20};  // DMX channels of the red LEDs
-  uint8_t g[6] = {2, 5, 8, 11, 17, 21};  // DMX channels of the green LEDs
-  uint8_t b[6] = {3, 6, 9, 12, 18, 22};  // DMX channels of the blue LEDs
-  uint8_t d[3] = {14, 15, 19};           // DMX channels of the dimmers
+  uint16_t r[6] = {1, 4, 7, 10, 16, 20};  // DMX channels of the red LEDs
+  uint16_t g[6] = {2, 5, 8, 11, 17, 21};  // DMX channels of the green LEDs
+  uint16_t b[6] = {3, 6, 9, 12, 18, 22};  // DMX channels of the blue LEDs
+  uint16_t d[3] = {14, 15, 19};           // DMX channels of the dimmers
 
 #ifdef USBSerial
   Serial.begin(9600);  // print info on the serial monitor, USB only
 #endif
   DMXSerial.init(DMXController);
   DMXSerial.maxChannel(128);
-  MDXBridge.begin();
+  MDXBridge.setSceneStore(&sceneStore);
+  MDXBridge.begin();  // outputs the scenes saved before the power-down
+  MDXBridge.setCoalescing(true);  // only the last value per controller and listen() matters
   MDXBridge.setStaticScene({{6, r}, {6, g}, {6, b}}, {0xff, 0xf8, 0xa7});
   MDXBridge.setStaticScene({{3, d}, {}, {}}, {0xff, 0x00, 0x00});
 }
@@ -99,6 +138,16 @@ void loop() {
   }
   digitalWrite(LED_BUILTIN, state);
 
-  MDXBridge.setAttenuation(analogRead(kSensorPin));
-  MDXBridge.listen();
+  if (MDXBridge.isAttenuationDue()) {
+    MDXBridge.updateAttenuation(analogRead(kSensorPin));  // smoothed, ADC noise is ignored
+  }
+  MDXBridge.poll();  // MIDI as often as possible, DMX at a fixed frame rate
+
+#ifdef USBSerial
+  trace.drain(Serial);  // only writes as much as the USB transmit buffer accepts
+#endif
+
+#if defined(USBSerial) && MIDIDMXBRIDGE_STATS
+  printStats(MDXBridge);
+#endif
 }
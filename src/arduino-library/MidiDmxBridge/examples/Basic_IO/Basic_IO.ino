@@ -54,11 +54,11 @@ class SerialReader : public mididmxbridge::ISerialReader {
  *
  * @see https://www.arduino.cc/reference/en/libraries/dmxserial/
  *
- * @param[in] channel the DMX channel in the range [1, 255]
+ * @param[in] channel the DMX channel in the range [1, 512]
  * @param[in] value the DMX value in the range [1, 255]
  */
-static void onDmxChange(const uint8_t channel, const uint8_t value) {
-  for (uint8_t c = 0; c < channel; c++) {
+static void onDmxChange(const uint16_t channel, const uint8_t value) {
+  for (uint16_t c = 0; c < channel; c++) {
     digitalWrite(LED_BUILTIN, HIGH);
     delay(100);
     digitalWrite(LED_BUILTIN, LOW);
@@ -48,10 +48,10 @@ class SerialReader : public mididmxbridge::ISerialReader {
  *
  * @see https://www.arduino.cc/reference/en/libraries/dmxserial/
  *
- * @param[in] channel the DMX channel in the range [1, 255]
+ * @param[in] channel the DMX channel in the range [1, 512]
  * @param[in] value the DMX value in the range [1, 255]
  */
-void onDmxChange(const uint8_t channel, const uint8_t value) {
+void onDmxChange(const uint16_t channel, const uint8_t value) {
   digitalWrite(LED_BUILTIN, HIGH);
   delay(value);  // light up the LED
   digitalWrite(LED_BUILTIN, LOW);
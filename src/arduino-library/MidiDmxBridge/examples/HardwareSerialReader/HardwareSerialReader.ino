@@ -0,0 +1,59 @@
+/**
+ * @file HardwareSerialReader.ino
+ * @author Christian Neukam
+ * @brief MidiDmxBridge library example to demonstrate the interrupt-driven hardware UART reader.
+ * @version 1.0
+ * @date 2024-02-10
+ *
+ * @copyright Copyright 2024 Christian Neukam. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <MidiDmxBridge.h>
+
+/**
+ * @brief Implementation of the callback mididmxbridge::dmx::DmxOnChangeCallback.
+ *
+ * This callback is always called as soon as a new DMX date is generated from a
+ * different MIDI CC signal. The built-in LED is switched on for DMX values greater than 127.
+ * The DMX data can then be sent further via a DMX library, e.g. DMXSerial.
+ *
+ * @see https://www.arduino.cc/reference/en/libraries/dmxserial/
+ *
+ * @param[in] channel the DMX channel in the range [1, 512]
+ * @param[in] value the DMX value in the range [1, 255]
+ */
+static void onDmxChange(const uint16_t /* channel */, const uint8_t value) {
+  digitalWrite(LED_BUILTIN, (value > 127) ? HIGH : LOW);
+}
+
+#define kMidiChannel 1                   /**< the MIDI channel to listen to in the range [1, 16] */
+static SerialReaderHardware<256> reader; /**< the hardware UART reader with a 256 byte buffer */
+static MidiDmxBridge MDXBridge(kMidiChannel, onDmxChange, reader); /**< the MidiDmxBridge object */
+
+MIDIDMXBRIDGE_SERIAL_READER_HARDWARE_ISR(reader) /**< forward the UART interrupt to the reader */
+
+/**
+ * @brief Setup the Arduino board.
+ *
+ */
+void setup() {
+  pinMode(LED_BUILTIN, OUTPUT);
+  MDXBridge.begin();
+}
+
+/**
+ * @brief Main processing loop.
+ *
+ */
+void loop() { MDXBridge.listen(); }
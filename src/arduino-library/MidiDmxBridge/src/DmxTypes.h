@@ -28,9 +28,12 @@
 #include <functional>
 #endif
 
+#include "midi_dmx/constants.h"
+#include "midi_dmx/static_vector.h"
 #include "midi_dmx/vector.h"
 
 namespace mididmxbridge {
+using mididmxbridge::static_vector;
 using mididmxbridge::vector;
 
 /**
@@ -38,11 +41,45 @@ using mididmxbridge::vector;
  *
  */
 #ifdef ARDUINO
-using DmxOnChangeCallback = void (*)(const uint8_t channel, const uint8_t value);
+using DmxOnChangeCallback = void (*)(const uint16_t channel, const uint8_t value);
 #else
-using DmxOnChangeCallback = std::function<void(const uint8_t, const uint8_t)>;
+using DmxOnChangeCallback = std::function<void(const uint16_t, const uint8_t)>;
 #endif
 
+/**
+ * @brief Definition of the frame callback signature.
+ *
+ * The callback receives a contiguous span of \p count DMX values, where \p values[0] is the value
+ * of DMX channel \p first.
+ *
+ */
+#ifdef ARDUINO
+using DmxOnFrameCallback = void (*)(const uint8_t* values, const uint16_t first,
+                                    const uint16_t count);
+#else
+using DmxOnFrameCallback = std::function<void(const uint8_t*, const uint16_t, const uint16_t)>;
+#endif
+
+/**
+ * @brief This enum defines the resolution MIDI CC values are converted to DMX values with.
+ *
+ */
+enum class DmxResolution : uint8_t {
+  k7Bit,  /**< every MIDI CC is a 7-bit value output in steps of 2 in the range [0, 254] */
+  k8Bit,  /**< 14-bit MIDI CC pairs and NRPN are output in the range [0, 255] */
+  k16Bit, /**< 14-bit MIDI CC pairs and NRPN are output as coarse and fine DMX channel pair */
+};
+
+/**
+ * @brief This enum defines the response curve DMX values are output with.
+ *
+ */
+enum class DmxCurve : uint8_t {
+  kLinear, /**< the DMX output is proportional to the DMX value */
+  kGamma,  /**< perceptual dimming with a gamma of 2.2, e.g. for LED fixtures */
+  kSCurve, /**< smoothstep curve, i.e. fine control at both ends of the range */
+};
+
 /**
  * @brief This struct defines a DMX color in the red-green-blue (RGB) domain.
  *
@@ -53,15 +90,44 @@ struct DmxRgb {
   uint8_t blue;  /**< the blue color intensity in the range [0, 254] */
 };
 
+/**
+ * @brief Definition of the DMX channel list of a primary color.
+ *
+ * The list holds up to ::MIDIDMXBRIDGE_MAX_RGB_CHANNELS channels without allocating heap memory.
+ * Initializing it with more channels, e.g. `DmxColorChannels({1, 2, 3})`, fails to compile;
+ * push_back() returns false for each channel beyond the capacity.
+ *
+ */
+using DmxColorChannels = static_vector<uint16_t, kMaxRgbChannels>;
+
 /**
  * @brief This struct defines the DMX channels that are assigned to the primary colors red, green
  * and blue.
  *
  */
 struct DmxRgbChannels {
-  vector<uint8_t> red;   /**< the red DMX channels */
-  vector<uint8_t> green; /**< the green DMX channels */
-  vector<uint8_t> blue;  /**< the blue DMX channels */
+  DmxColorChannels red;   /**< the red DMX channels */
+  DmxColorChannels green; /**< the green DMX channels */
+  DmxColorChannels blue;  /**< the blue DMX channels */
 };
+
+#if MIDIDMXBRIDGE_STATS
+/**
+ * @brief This struct defines a snapshot of the runtime statistics of MidiDmxBridge::listen().
+ *
+ * All counters are accumulated since the last MidiDmxBridge::resetStats() call and wrap around.
+ *
+ */
+struct MidiDmxBridgeStats {
+  uint32_t messages;     /**< the number of MIDI CC messages decoded */
+  uint32_t droppedBytes; /**< the number of MIDI data bytes discarded by the parser */
+  uint32_t resyncs;      /**< the number of partial MIDI messages aborted by a status byte */
+  uint32_t overflows;    /**< the number of overflows of the serial input buffer */
+  uint32_t callbacks;    /**< the number of DMX callbacks triggered */
+  uint32_t loops;        /**< the number of listen() calls */
+  uint32_t maxLoopUs;    /**< the longest listen() call in µs, excluding the idle sleep */
+  uint32_t avgLoopUs;    /**< the moving average of the listen() duration in µs */
+};
+#endif
 }  // namespace mididmxbridge
 #endif
@@ -0,0 +1,61 @@
+/**
+ * @file IClock.h
+ * @author Christian Neukam
+ * @brief Definition of the mididmxbridge::IClock interface.
+ * @version 1.0
+ * @date 2024-03-05
+ *
+ * @copyright Copyright 2024 Christian Neukam. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef __MIDIDMXBRIDGE_I_CLOCK_H__
+#define __MIDIDMXBRIDGE_I_CLOCK_H__
+
+#include <stdint.h>
+
+namespace mididmxbridge {
+
+/**
+ * @brief Interface of an object providing the elapsed time.
+ *
+ */
+class IClock {
+ public:
+  /**
+   * @brief Destroy the IClock object.
+   *
+   */
+  virtual ~IClock() = default;
+
+  /**
+   * @brief Get the time elapsed since an arbitrary, fixed point in time.
+   *
+   * The value may overflow, i.e. only differences between two values are evaluated.
+   *
+   * @return uint32_t - the elapsed time in ms
+   */
+  virtual uint32_t millis() = 0;
+
+  /**
+   * @brief Get the time elapsed since an arbitrary, fixed point in time in µs.
+   *
+   * The value may overflow, i.e. only differences between two values are evaluated. The default
+   * implementation derives the time from millis().
+   *
+   * @return uint32_t - the elapsed time in µs
+   */
+  virtual uint32_t micros() { return millis() * 1000UL; }
+};
+}  // namespace mididmxbridge
+#endif
@@ -0,0 +1,85 @@
+/**
+ * @file ISceneStore.h
+ * @author Christian Neukam
+ * @brief Definition of the mididmxbridge::ISceneStore interface.
+ * @version 1.0
+ * @date 2024-03-12
+ *
+ * @copyright Copyright 2024 Christian Neukam. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef __MIDIDMXBRIDGE_I_SCENE_STORE_H__
+#define __MIDIDMXBRIDGE_I_SCENE_STORE_H__
+
+#include <stdint.h>
+
+namespace mididmxbridge {
+
+/**
+ * @brief Interface of a non-volatile memory persisting the DMX scenes, e.g. the EEPROM.
+ *
+ */
+class ISceneStore {
+ public:
+  /**
+   * @brief Destroy the ISceneStore object.
+   *
+   */
+  virtual ~ISceneStore() = default;
+
+  /**
+   * @brief Get the size of the memory.
+   *
+   * @return uint16_t - the number of bytes available
+   */
+  virtual uint16_t length() = 0;
+
+  /**
+   * @brief Read a byte of the memory.
+   *
+   * @param[in] address the address in the range [0, length() - 1]
+   * @return uint8_t - the value of the byte
+   */
+  virtual uint8_t read(const uint16_t address) = 0;
+
+  /**
+   * @brief Read \p size consecutive bytes of the memory.
+   *
+   * The default implementation forwards to read(). Implementations should override this function
+   * to transfer the data with a single sequential read.
+   *
+   * @param[in] address the address of the first byte
+   * @param[out] dst the destination buffer, which must hold at least \p size bytes
+   * @param[in] size the number of bytes to read
+   */
+  virtual void readBytes(const uint16_t address, uint8_t* dst, const uint16_t size) {
+    for (uint16_t idx = 0; idx < size; idx++) {
+      dst[idx] = read(address + idx);
+    }
+  }
+
+  /**
+   * @brief Write a byte of the memory if its value differs.
+   *
+   * Unchanged bytes must not be written to avoid wearing out the memory cells.
+   *
+   * @param[in] address the address in the range [0, length() - 1]
+   * @param[in] value the value to write
+   * @return true - the byte got written
+   * @return false - the byte already had this value
+   */
+  virtual bool update(const uint16_t address, const uint8_t value) = 0;
+};
+}  // namespace mididmxbridge
+#endif
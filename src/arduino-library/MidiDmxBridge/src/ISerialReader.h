@@ -22,6 +22,14 @@
 #ifndef __MIDIDMXBRIDGE_I_SERIAL_READER_H__
 #define __MIDIDMXBRIDGE_I_SERIAL_READER_H__
 
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef ARDUINO
+#include <Arduino.h>
+#endif
+
+#include "IClock.h"
 #include "ISleep.h"
 
 namespace mididmxbridge {
@@ -30,7 +38,7 @@ namespace mididmxbridge {
  * @brief Interface of an object reading data from a serial hardware interface.
  *
  */
-class ISerialReader : public ISleep {
+class ISerialReader : public ISleep, public IClock {
  public:
   /**
    * @brief Destroy the ISerialReader object.
@@ -57,6 +65,56 @@ class ISerialReader : public ISleep {
    * @return int - the value of the data
    */
   virtual int read() = 0;
+
+  /**
+   * @brief Get up to \p max bytes from the serial input stack without blocking.
+   *
+   * The default implementation forwards to available() and read(). Implementations should override
+   * this function to transfer a whole burst of data with a single call.
+   *
+   * @param[out] dst the destination buffer, which must hold at least \p max bytes
+   * @param[in] max the maximum number of bytes to transfer
+   * @return size_t - the number of bytes transferred to \p dst
+   */
+  virtual size_t readBytes(uint8_t* dst, const size_t max) {
+    size_t count = 0;
+
+    while ((count < max) && (available() > 0)) {
+      dst[count++] = (uint8_t)read();
+    }
+
+    return count;
+  }
+
+  /**
+   * @brief Check whether the serial input buffer overflowed since the last call.
+   *
+   * The default implementation never reports an overflow.
+   *
+   * @return true - bytes got lost since the last call
+   * @return false - otherwise
+   */
+  virtual bool overflow() { return false; }
+
+#ifdef ARDUINO
+  /**
+   * @brief Get the time elapsed since the Arduino board began running the sketch.
+   *
+   * The default implementation forwards to the Arduino millis() function.
+   *
+   * @return uint32_t - the elapsed time in ms
+   */
+  uint32_t millis() override { return ::millis(); }
+
+  /**
+   * @brief Get the time elapsed since the Arduino board began running the sketch in µs.
+   *
+   * The default implementation forwards to the Arduino micros() function.
+   *
+   * @return uint32_t - the elapsed time in µs
+   */
+  uint32_t micros() override { return ::micros(); }
+#endif
 };
 }  // namespace mididmxbridge
 #endif
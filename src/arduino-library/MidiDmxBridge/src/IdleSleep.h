@@ -0,0 +1,94 @@
+/**
+ * @file IdleSleep.h
+ * @author Christian Neukam
+ * @brief Idle sleep of the serial readers, woken up by the received data.
+ * @version 1.0
+ * @date 2024-03-17
+ *
+ * @copyright Copyright 2024 Christian Neukam. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef __MIDIDMXBRIDGE_IDLE_SLEEP_H__
+#define __MIDIDMXBRIDGE_IDLE_SLEEP_H__
+
+#include <stdint.h>
+
+#ifdef ARDUINO
+#include <Arduino.h>
+#endif
+
+#if defined(ARDUINO) && defined(__AVR__)
+#include <avr/interrupt.h>
+#include <avr/sleep.h>
+#endif
+
+namespace mididmxbridge {
+/**
+ * @brief Wait until the serial reader received data or the sleep time elapsed.
+ *
+ * In contrast to a plain delay, the wait ends as soon as data is available, i.e. the processing of
+ * a received byte starts right after the interrupt that stored it.
+ *
+ * @tparam Reader the serial reader, e.g. an implementation of mididmxbridge::ISerialReader
+ * @tparam Wait the type of the wait function
+ * @param[in] reader the serial reader providing available() and millis()
+ * @param[in] sleep_ms the maximum wait time in ms
+ * @param[in] wait the function waiting for the next interrupt, which shall not wait if data is
+ * already available
+ */
+template <class Reader, class Wait>
+void idleWait(Reader& reader, const uint16_t sleep_ms, Wait wait) {
+  const uint32_t start_ms = reader.millis();
+
+  while ((reader.available() <= 0) && ((reader.millis() - start_ms) < sleep_ms)) {
+    wait();
+  }
+}
+
+#ifdef ARDUINO
+/**
+ * @brief Sleep until the serial reader received data or the sleep time elapsed.
+ *
+ * On AVR boards, the CPU is put into the idle sleep mode between two interrupts, i.e. it is woken
+ * up by the receive interrupt of the UART, the pin change interrupt of SoftwareSerial or the
+ * millis() timer tick about every 1 ms. Other interrupts, e.g. the transmit interrupt of a DMX
+ * library, wake the CPU as well and the wait continues. On other boards, the function falls back
+ * to the Arduino delay() function.
+ *
+ * @tparam Reader the serial reader, e.g. an implementation of mididmxbridge::ISerialReader
+ * @param[in] reader the serial reader providing available() and millis()
+ * @param[in] sleep_ms the maximum sleep time in ms
+ */
+template <class Reader>
+void idleSleep(Reader& reader, const uint16_t sleep_ms) {
+#ifdef __AVR__
+  set_sleep_mode(SLEEP_MODE_IDLE);
+  idleWait(reader, sleep_ms, [&reader]() {
+    cli();
+    if (reader.available() <= 0) {  // a byte may have arrived since the last check
+      sleep_enable();
+      sei();  // the instruction after sei() is executed before a pending interrupt
+      sleep_cpu();
+      sleep_disable();
+    }
+    sei();
+  });
+#else
+  (void)reader;
+  delay(sleep_ms);
+#endif
+}
+#endif
+}  // namespace mididmxbridge
+#endif
@@ -23,22 +23,69 @@
 #define __MIDIDMXBRIDGE_H__
 
 #include "DmxTypes.h"
+#include "ISceneStore.h"
 #include "ISerialReader.h"
+#include "SceneStoreEeprom.h"
 #include "SerialReaderDefault.h"
+#include "SerialReaderHardware.h"
+#include "midi_dmx/CcCoalescer.h"
 #include "midi_dmx/Dmx.h"
+#include "midi_dmx/GainFilter.h"
 #include "midi_dmx/MidiReader.h"
+#include "midi_dmx/TraceRing.h"
+#include "midi_dmx/static_vector.h"
 #include "midi_dmx/vector.h"
 
+using mididmxbridge::DmxColorChannels;
+using mididmxbridge::DmxCurve;
 using mididmxbridge::DmxOnChangeCallback;
+using mididmxbridge::DmxOnFrameCallback;
+using mididmxbridge::DmxResolution;
 using mididmxbridge::DmxRgb;
 using mididmxbridge::DmxRgbChannels;
+using mididmxbridge::ISceneStore;
 using mididmxbridge::ISerialReader;
+#if MIDIDMXBRIDGE_STATS
+using mididmxbridge::MidiDmxBridgeStats;
+#endif
+using mididmxbridge::TraceRing;
 using mididmxbridge::dmx::Dmx;
+using mididmxbridge::dmx::GainFilter;
+using mididmxbridge::midi::BasicMidiReader;
+using mididmxbridge::midi::CcCoalescer;
 using mididmxbridge::midi::MidiReader;
 
+#if defined(ARDUINO) && defined(__AVR__)
 namespace mididmxbridge {
-class ISleep; /**< forward declaration */
-}
+const uint16_t kMinFreeSram = 512; /**< SRAM left to the Arduino core, the sketch and the stack */
+}  // namespace mididmxbridge
+
+static_assert(sizeof(Dmx) + mididmxbridge::kMinFreeSram <= (RAMEND - RAMSTART + 1),
+              "the DMX buffers exceed the SRAM of the board, reduce MIDIDMXBRIDGE_MAX_DMX_CHANNEL "
+              "or disable the unused MIDIDMXBRIDGE_USE_* features");
+static_assert(Dmx::sceneStoreSize() <= (E2END + 1),
+              "the scenes exceed the EEPROM, reduce MIDIDMXBRIDGE_MAX_DMX_CHANNEL or "
+              "MIDIDMXBRIDGE_STATIC_SCENE_SLOTS");
+#endif
+
+namespace mididmxbridge {
+/**
+ * @brief This struct defines the default configuration of a BasicMidiDmxBridge.
+ *
+ * The values are compile-time constants, i.e. an application may derive its own configuration
+ * from this struct and override single values, e.g. \p kUseCoalescing. All values can still be
+ * changed at runtime via the corresponding setters.
+ *
+ */
+struct DefaultBridgeConfig {
+  static constexpr uint8_t kListenBudget = kDefaultListenBudget;   /**< see setListenBudget() */
+  static constexpr uint16_t kIdleSleepMs = kDefaultIdleSleepMs;    /**< see setIdleSleep() */
+  static constexpr uint8_t kRefreshBudget = kDefaultRefreshBudget; /**< see setRefreshBudget() */
+  static constexpr bool kUseCoalescing = false;                    /**< see setCoalescing() */
+  static constexpr uint8_t kFrameRate = kDefaultFrameRate;         /**< see setFrameRate() */
+  static constexpr DmxCurve kCurve = DmxCurve::kLinear;            /**< see setCurve() */
+};
+}  // namespace mididmxbridge
 
 /**
  * @brief This class defines the API of the MidiDmxBridge library.
@@ -54,41 +101,243 @@ class ISleep; /**< forward declaration */
  * In order to adapt the brightness of the connected lighting to the local conditions, a gain can be
  * set to adjust the brightness. The signal can only be attenuated.
  *
+ * The serial interface and the configuration are template parameters. MidiDmxBridge uses the
+ * abstract mididmxbridge::ISerialReader interface. With a final serial reader type, e.g.
+ * \p BasicMidiDmxBridge<SerialReaderHardware<>>, the serial interface is called without virtual
+ * dispatch and the compiler may inline the whole path from the serial bytes to the DMX callback.
+ *
+ * @tparam Reader the type of the serial interface, providing the mididmxbridge::ISerialReader API
+ * @tparam Config the configuration, see mididmxbridge::DefaultBridgeConfig
  */
-class MidiDmxBridge {
+template <class Reader, class Config = mididmxbridge::DefaultBridgeConfig>
+class BasicMidiDmxBridge {
  public:
   /**
-   * @brief Construct a new MidiDmxBridge object.
+   * @brief Construct a new BasicMidiDmxBridge object.
    *
    * @param[in] channel the MIDI channel to listen to in the range [1, 16]
    * @param[in] callback the callback to trigger once the DMX values change
    * @param[in] serial the serial interface
    */
-  MidiDmxBridge(const uint8_t channel, DmxOnChangeCallback callback, ISerialReader& serial);
+  BasicMidiDmxBridge(const uint8_t channel, DmxOnChangeCallback callback, Reader& serial)
+      : mSerial(serial),
+        mDmx(callback),
+        mGainFilter(),
+        mReader(channel, serial),
+        mCoalescer(),
+        mUseCoalescing(Config::kUseCoalescing),
+        mListenBudget(mididmxbridge::util::max_t(Config::kListenBudget, (uint8_t)1)),
+        mIdleSleep(Config::kIdleSleepMs)
+#if MIDIDMXBRIDGE_USE_FRAME_MODE
+        ,
+        mFramePeriodUs(framePeriod(Config::kFrameRate)),
+        mFrameStartUs(0)
+#endif
+#if MIDIDMXBRIDGE_STATS
+        ,
+        mMessages(0),
+        mOverflows(0),
+        mLoops(0),
+        mMaxLoopUs(0),
+        mLoopUsSum(0)
+#endif
+  {
+    mDmx.setRefreshBudget(Config::kRefreshBudget);
+    mDmx.setCurve(Config::kCurve);
+  }
 
   /**
-   * @brief Destroy the MidiDmxBridge object.
+   * @brief Initialize the BasicMidiDmxBridge object.
+   *
+   * This function should be called before all other API functions in the Arduino sketch in setup(),
+   * except setSceneStore(). If a scene store is set, the static presets and the dynamic scene saved
+   * before the last power-down are restored and the active scene is output immediately.
    *
    */
-  virtual ~MidiDmxBridge() = default;
+  void begin() {
+    mReader.begin();
+    mDmx.restoreScenes();
+  }
 
   /**
-   * @brief Initialize the MidiDmxBridge object.
+   * @brief Set the non-volatile memory to persist the scenes in, e.g. a SceneStoreEeprom object.
+   *
+   * The static presets and the dynamic scene are saved lazily by listen() once they have not
+   * changed for the save delay, see setSceneSaveDelay(). Only bytes actually changing are written
+   * and at most one per listen() call, i.e. the scene bank of
+   * mididmxbridge::dmx::SceneBank::size() bytes wears the EEPROM as little as possible. By default,
+   * the scenes are not persisted. A store smaller than the scene bank is rejected, e.g. an EEPROM
+   * offset leaving too little space, since writing it would overflow into foreign memory.
    *
-   * This function should be called before all other API functions in the Arduino sketch in setup().
+   * This function should be used in the Arduino sketch in setup() before begin().
    *
+   * @param[in] store the store, nullptr to disable persisting the scenes
+   * @return true - the store is used, or persisting got disabled via nullptr
+   * @return false - the store is too small, the scenes are not persisted
    */
-  void begin();
+  bool setSceneStore(ISceneStore* store) { return mDmx.setSceneStore(store); }
 
   /**
-   * @brief Setup the static scene.
+   * @brief Set the time the scenes must be unchanged before they are saved to the scene store.
    *
-   * This function should be used in the Arduino sketch in setup() after begin().
+   * A longer delay coalesces more changes into a single save, i.e. reduces the EEPROM wear, at the
+   * expense of losing the latest changes on power-down. The default is
+   * mididmxbridge::kDefaultSceneSaveDelayMs.
+   *
+   * This function can always be called.
+   *
+   * @param[in] delay_ms the save delay in ms
+   */
+  void setSceneSaveDelay(const uint16_t delay_ms) { mDmx.setSceneSaveDelay(delay_ms); }
+
+  /**
+   * @brief Check whether all changes of the scenes have been saved to the scene store.
+   *
+   * This function can always be called, e.g. to delay powering down until the scenes are saved.
+   *
+   * @return true - no change is pending and no save is running
+   * @return false - otherwise
+   */
+  bool isSceneSaved() const { return mDmx.isSceneSaved(); }
+
+  /**
+   * @brief Setup the static scene of the selected preset.
+   *
+   * This function should be used in the Arduino sketch in setup() after begin(). The values are
+   * stored by DMX channel, i.e. calling it again overwrites the channels instead of adding them.
+   *
+   * @see selectStaticScene
    *
    * @param[in] channels the DMX channels associated with RGB
    * @param[in] rgb the RGB value to set
    */
-  void setStaticScene(const DmxRgbChannels& channels, const DmxRgb& rgb);
+  void setStaticScene(const DmxRgbChannels& channels, const DmxRgb& rgb) {
+    mDmx.setStaticScene(channels, rgb);
+  }
+
+  /**
+   * @brief Setup the static scene of a preset.
+   *
+   * Up to mididmxbridge::kStaticSceneSlots presets can be stored, see
+   * MIDIDMXBRIDGE_STATIC_SCENE_SLOTS.
+   *
+   * This function can always be called after begin().
+   *
+   * @param[in] slot the preset in the range [0, mididmxbridge::kStaticSceneSlots - 1]
+   * @param[in] channels the DMX channels associated with RGB
+   * @param[in] rgb the RGB value to set
+   * @return true - the scene got set up
+   * @return false - the slot is out of range
+   */
+  bool setStaticScene(const uint8_t slot, const DmxRgbChannels& channels, const DmxRgb& rgb) {
+    return mDmx.setStaticScene(slot, channels, rgb);
+  }
+
+  /**
+   * @brief Remove all channels from the static scene of a preset.
+   *
+   * This function can always be called after begin().
+   *
+   * @param[in] slot the preset in the range [0, mididmxbridge::kStaticSceneSlots - 1]
+   * @return true - the scene got cleared
+   * @return false - the slot is out of range
+   */
+  bool clearStaticScene(const uint8_t slot) { return mDmx.clearStaticScene(slot); }
+
+  /**
+   * @brief Select the preset used as static scene.
+   *
+   * If the static scene is active, the selected preset is output immediately and channels missing
+   * in it are turned off. The preset defaults to 0.
+   *
+   * This function can always be called after begin().
+   *
+   * @param[in] slot the preset in the range [0, mididmxbridge::kStaticSceneSlots - 1]
+   * @return true - the preset got selected
+   * @return false - the slot is out of range
+   */
+  bool selectStaticScene(const uint8_t slot) { return mDmx.selectStaticScene(slot); }
+
+  /**
+   * @brief Set the MIDI channels to listen to.
+   *
+   * Bit n of the mask enables the MIDI channel n + 1, e.g. 0x0003 listens to the MIDI channels 1
+   * and 2 and 0xffff listens to all MIDI channels. All enabled MIDI channels are decoded in a
+   * single pass over the serial data. The mask replaces the MIDI channel passed to the constructor.
+   *
+   * This function can always be called after begin().
+   *
+   * @see mididmxbridge::midi::MidiReader::setChannelMask
+   *
+   * @param[in] mask the MIDI channel mask
+   */
+  void setChannelMask(const uint16_t mask) { mReader.setChannelMask(mask); }
+
+  /**
+   * @brief Set the DMX channel offset of a MIDI channel.
+   *
+   * As long as no patch is defined via patch(), MIDI CC values received on the MIDI channel are
+   * output on the DMX channel controller + \p offset. This way, each MIDI channel can drive its own
+   * fixture group.
+   *
+   * This function should be used in the Arduino sketch in setup() after begin().
+   *
+   * @see mididmxbridge::dmx::Dmx::setChannelOffset
+   *
+   * @param[in] midiChannel the MIDI channel in the range [1, 16]
+   * @param[in] offset the DMX channel offset in the range [0, ::MIDIDMXBRIDGE_MAX_DMX_CHANNEL]
+   * @return true - the offset got set
+   * @return false - the parameters are out of range
+   */
+  bool setChannelOffset(const uint8_t midiChannel, const uint16_t offset) {
+    return mDmx.setChannelOffset(midiChannel, offset);
+  }
+
+#if MIDIDMXBRIDGE_USE_HIGH_RES
+  /**
+   * @brief Set the resolution MIDI CC values are converted to DMX values with.
+   *
+   * By default, every MIDI CC value is output as 7-bit value in steps of 2. With
+   * DmxResolution::k8Bit or DmxResolution::k16Bit, 14-bit MIDI CC pairs, i.e. the MSB on the
+   * controllers [0, 31] and the LSB on the controllers [32, 63], and NRPN messages are decoded and
+   * output with the full 8-bit DMX range or as coarse and fine DMX channel pair.
+   *
+   * This function should be used in the Arduino sketch in setup() after begin().
+   *
+   * @see mididmxbridge::dmx::Dmx::setResolution
+   *
+   * @param[in] resolution the resolution to use
+   */
+  void setResolution(const DmxResolution resolution) { mDmx.setResolution(resolution); }
+#endif
+
+  /**
+   * @brief Patch a MIDI CC controller to a DMX address.
+   *
+   * By default, the MIDI CC controller number is used as DMX channel, which limits the output to
+   * the DMX channels [0, 127]. Patches map MIDI CC controllers to any DMX address up to
+   * ::MIDIDMXBRIDGE_MAX_DMX_CHANNEL, which can be raised to 512 to cover the full DMX universe. As
+   * soon as a patch is defined, only patched MIDI CC controllers are output.
+   *
+   * This function should be used in the Arduino sketch in setup() after begin().
+   *
+   * @see mididmxbridge::dmx::Dmx::patch
+   *
+   * @param[in] controller the MIDI CC controller in the range [0, 127]
+   * @param[in] address the DMX address in the range [1, ::MIDIDMXBRIDGE_MAX_DMX_CHANNEL]
+   * @param[in] midiChannel the MIDI channel in the range [1, 16] or 0 for any MIDI channel
+   * @return true - the patch got added
+   * @return false - the parameters are out of range or ::MIDIDMXBRIDGE_MAX_PATCHES is exceeded
+   */
+  bool patch(const uint8_t controller, const uint16_t address, const uint8_t midiChannel = 0) {
+    return mDmx.patch(controller, address, midiChannel);
+  }
+
+  /**
+   * @brief Remove all patches defined via patch().
+   *
+   */
+  void clearPatches() { mDmx.clearPatches(); }
 
   /**
    * @brief Sets the attenuation of the generated DMX signal.
@@ -96,11 +345,71 @@ class MidiDmxBridge {
    * The attenuation shall be in the range [0, mididmxbridge::dmx::kUnityGainValue] otherwise it is
    * clipped whereas unity gain does mean no attenuation.
    *
+   * The DMX channels are output with the new attenuation incrementally by the next listen() calls,
+   * see setRefreshBudget().
+   *
    * This function should be used in the Arduino sketch in loop().
    *
    * @param[in] attenuation the integer based attenuation to apply
    */
-  void setAttenuation(const uint16_t attenuation);
+  void setAttenuation(const uint16_t attenuation) { mDmx.setGain(attenuation); }
+
+  /**
+   * @brief Update the attenuation from a noisy analog input, e.g. a potentiometer.
+   *
+   * In contrast to setAttenuation(), the samples are decimated to one per interval set via
+   * setAttenuationInterval(), smoothed and quantised to 128 levels with hysteresis, see
+   * mididmxbridge::dmx::GainFilter. The DMX channels are only refreshed if the quantised
+   * attenuation changes, i.e. ADC noise does not cost any loop time. Samples before the interval
+   * elapsed are discarded, so reading the analog input only if isAttenuationDue() saves the time of
+   * the conversion as well.
+   *
+   * This function should be used in the Arduino sketch in loop() instead of setAttenuation(). Both
+   * functions shall not be mixed.
+   *
+   * @param[in] sample the analog sample in the range [0, mididmxbridge::dmx::kUnityGainValue]
+   */
+  void updateAttenuation(const uint16_t sample) {
+    if (mGainFilter.update(sample, mSerial.millis())) {
+      mDmx.setGain(mGainFilter.gain());
+    }
+  }
+
+  /**
+   * @brief Check whether updateAttenuation() processes the next sample.
+   *
+   * @return true - the next sample is due
+   * @return false - updateAttenuation() would discard the sample
+   */
+  bool isAttenuationDue() { return mGainFilter.isDue(mSerial.millis()); }
+
+  /**
+   * @brief Set the interval between two samples processed by updateAttenuation().
+   *
+   * The default is mididmxbridge::kDefaultAttenuationIntervalMs.
+   *
+   * This function can always be called.
+   *
+   * @param[in] interval_ms the interval in ms, 0 to process every sample
+   */
+  void setAttenuationInterval(const uint16_t interval_ms) { mGainFilter.setInterval(interval_ms); }
+
+  /**
+   * @brief Set the response curve of the generated DMX signal.
+   *
+   * With mididmxbridge::DmxCurve::kLinear, the default, the DMX value is proportional to the MIDI
+   * CC value. mididmxbridge::DmxCurve::kGamma provides a perceptually even dimming of LED fixtures,
+   * mididmxbridge::DmxCurve::kSCurve a finer control at both ends of the range. The curve tables
+   * are generated at compile time and stored in flash memory.
+   *
+   * The curve is applied to all DMX channels, including the fine channels of 16-bit values, see
+   * setResolution(). The DMX channels are output with the new curve like after setAttenuation().
+   *
+   * This function can always be called.
+   *
+   * @param[in] curve the response curve to apply
+   */
+  void setCurve(const DmxCurve curve) { mDmx.setCurve(curve); }
 
   /**
    * @brief Switch to the dynamic scene.
@@ -110,7 +419,7 @@ class MidiDmxBridge {
    * This function can always be called after begin().
    *
    */
-  void switchToDynamicScene();
+  void switchToDynamicScene() { mDmx.activateDynamicScene(); }
 
   /**
    * @brief Switch to the static scene.
@@ -120,19 +429,409 @@ class MidiDmxBridge {
    * This function can always be called after begin().
    *
    */
-  void switchToStaticScene();
+  void switchToStaticScene() { mDmx.activateStaticScene(); }
+
+  /**
+   * @brief Set the maximum number of DMX channels output per listen() call after a gain change.
+   *
+   * The default is mididmxbridge::kDefaultRefreshBudget, which bounds the time each listen() call
+   * spends on refreshing the scene while the attenuation is adjusted. A budget of 0 outputs all
+   * DMX channels immediately within setAttenuation().
+   *
+   * This function can always be called.
+   *
+   * @see mididmxbridge::dmx::Dmx::setRefreshBudget
+   *
+   * @param[in] budget the maximum number of DMX channels to refresh per listen() call
+   */
+  void setRefreshBudget(const uint8_t budget) { mDmx.setRefreshBudget(budget); }
+
+  /**
+   * @brief Get the progress of the scene refresh after a gain change.
+   *
+   * @return uint8_t - the share of the DMX channels already refreshed in percent, 100 if no refresh
+   * is pending
+   */
+  uint8_t refreshProgress() const { return mDmx.refreshProgress(); }
 
   /**
-   * @brief Listen on the serial interface for the next MIDI CC value and update the DMX state.
+   * @brief Set the duration of the crossfade between the static and the dynamic scene.
+   *
+   * With a fade time of 0, the default, switchToStaticScene() and switchToDynamicScene() switch
+   * instantly. Otherwise, the scenes are crossfaded over the fade time, whereas each listen() call
+   * outputs at most as many DMX channels as set via setFadeBudget(). The time is taken from
+   * mididmxbridge::IClock::millis() of the serial interface.
+   *
+   * This function can always be called.
+   *
+   * @see mididmxbridge::dmx::Dmx::setFadeTime
+   *
+   * @param[in] fade_ms the fade time in ms
+   */
+  void setFadeTime(const uint16_t fade_ms) { mDmx.setFadeTime(fade_ms); }
+
+  /**
+   * @brief Set the maximum number of DMX channels output per listen() call during a crossfade.
+   *
+   * A budget of 0 is clipped to 1. The default is mididmxbridge::kDefaultFadeBudget.
+   *
+   * This function can always be called.
+   *
+   * @param[in] budget the maximum number of DMX channels to fade per listen() call
+   */
+  void setFadeBudget(const uint8_t budget) { mDmx.setFadeBudget(budget); }
+
+#if MIDIDMXBRIDGE_USE_FRAME_MODE
+  /**
+   * @brief Enable or disable the frame-based DMX output mode.
+   *
+   * In the frame-based mode, DMX changes are collected and the DmxOnChangeCallback callback is
+   * triggered once per changed DMX channel at the end of each listen() call.
+   *
+   * @see mididmxbridge::dmx::Dmx::setFrameMode
+   *
+   * @param[in] enable true to enable the frame-based mode, false to use the immediate mode
+   */
+  void setFrameMode(const bool enable) { mDmx.setFrameMode(enable); }
+
+  /**
+   * @brief Register a callback receiving all changed DMX channels as one contiguous span.
+   *
+   * Registering a valid callback enables the frame-based DMX output mode, see setFrameMode(). The
+   * callback is then triggered at most once per listen() call instead of the DmxOnChangeCallback
+   * callback, e.g. to copy the span directly into the buffer of a DMX library.
+   *
+   * @see mididmxbridge::dmx::Dmx::setFrameCallback
+   *
+   * @param[in] callback the callback to trigger once the DMX values change
+   */
+  void setFrameCallback(DmxOnFrameCallback callback) { mDmx.setFrameCallback(callback); }
+#endif
+
+#if MIDIDMXBRIDGE_USE_SINKS
+  /**
+   * @brief Add a sink mirroring the DMX output, e.g. to a second universe or an Ethernet node.
+   *
+   * Each sink is written with the span of the shared frame buffer covering the channels changed
+   * since its previous write, at most once per \p interval_ms. The first write covers the whole
+   * frame. listen() and poll() write at most one due sink per call, i.e. a slow sink does not hold
+   * back the DMX output or the other sinks. The sinks receive the values after the gain and the
+   * response curve are applied, see setAttenuation() and setCurve().
+   *
+   * This function can always be called, up to ::MIDIDMXBRIDGE_MAX_SINKS sinks can be added.
+   *
+   * @see mididmxbridge::dmx::Dmx::addSink
+   *
+   * @param[in] callback the callback writing the span of DMX values to the sink
+   * @param[in] interval_ms the minimum interval between two writes in ms, 0 for every call
+   * @return true - the sink got added
+   * @return false - the callback is invalid or ::MIDIDMXBRIDGE_MAX_SINKS is exceeded
+   */
+  bool addSink(DmxOnFrameCallback callback, const uint16_t interval_ms = 0) {
+    return mDmx.addSink(callback, interval_ms);
+  }
+
+  /**
+   * @brief Remove all sinks added via addSink().
+   *
+   */
+  void clearSinks() { mDmx.clearSinks(); }
+#endif
+
+  /**
+   * @brief Enable or disable the coalescing of redundant MIDI CC messages per listen() call.
+   *
+   * Controllers often send many intermediate values within a few ms. With coalescing enabled, only
+   * the last value per MIDI channel and controller of the messages processed by a listen() call is
+   * converted to DMX, i.e. at most one callback per DMX channel is triggered. Messages decoded as
+   * part of 14-bit values or NRPN, see setResolution(), are still passed in the order received.
+   *
+   * By default, coalescing is disabled, i.e. one callback is triggered per MIDI CC message. Up to
+   * ::MIDIDMXBRIDGE_COALESCE_SIZE distinct controllers are coalesced at once.
+   *
+   * This function can always be called.
+   *
+   * @param[in] enable true to coalesce the MIDI CC messages, false to process every message
+   */
+  void setCoalescing(const bool enable) { mUseCoalescing = enable; }
+
+  /**
+   * @brief Set the maximum number of MIDI CC messages processed per listen() call.
+   *
+   * A budget of 0 is clipped to 1. The default is mididmxbridge::kDefaultListenBudget.
+   *
+   * This function can always be called.
+   *
+   * @param[in] budget the maximum number of MIDI CC messages to decode per listen() call
+   */
+  void setListenBudget(const uint8_t budget) {
+    mListenBudget = mididmxbridge::util::max_t(budget, (uint8_t)1);
+  }
+
+  /**
+   * @brief Set the time listen() sleeps once the serial input buffer has been drained.
+   *
+   * A sleep time of 0 disables sleeping completely, e.g. for sketches that manage their own timing.
+   * The default is mididmxbridge::kDefaultIdleSleepMs.
+   *
+   * This function can always be called.
+   *
+   * @param[in] sleep_ms the idle sleep time in ms
+   */
+  void setIdleSleep(const uint16_t sleep_ms) { mIdleSleep = sleep_ms; }
+
+#if MIDIDMXBRIDGE_USE_FRAME_MODE
+  /**
+   * @brief Set the fixed rate poll() outputs the DMX frames at.
+   *
+   * A rate of 0 outputs a frame on every poll() call. The default is
+   * mididmxbridge::kDefaultFrameRate, the maximum refresh rate of a complete DMX universe.
+   *
+   * This function can always be called.
+   *
+   * @param[in] rate_hz the number of DMX frames per second
+   */
+  void setFrameRate(const uint8_t rate_hz) { mFramePeriodUs = framePeriod(rate_hz); }
+#endif
+
+  /**
+   * @brief Listen on the serial interface for MIDI CC values and update the DMX state.
+   *
+   * All complete MIDI CC messages currently available on the serial interface are processed, up to
+   * the budget set via setListenBudget(). The function only sleeps if the serial input buffer is
+   * empty afterwards, see setIdleSleep(). A running crossfade, a pending scene refresh and a
+   * pending save of the scenes are advanced, see setFadeTime(), setRefreshBudget() and
+   * setSceneStore().
    *
    * This function should be used in the Arduino sketch in loop().
    *
    */
-  void listen();
+  void listen() {
+#if MIDIDMXBRIDGE_STATS
+    const uint32_t start_us = mSerial.micros();
+#endif
+
+    ingest();
+    outputFrame();
+#if MIDIDMXBRIDGE_STATS
+    updateStats(mSerial.micros() - start_us);
+#endif
+
+    if ((mIdleSleep > 0) && !mReader.hasPendingData()) {
+      mSerial.sleep(mIdleSleep);  // nothing left to process, give the callbacks time to settle
+    }
+  }
+
+#if MIDIDMXBRIDGE_USE_FRAME_MODE
+  /**
+   * @brief Poll the serial interface for MIDI CC values and output the DMX frames at a fixed rate.
+   *
+   * In contrast to listen(), this function never sleeps and decouples the DMX output from the MIDI
+   * input: every call processes the available MIDI CC messages up to the budget set via
+   * setListenBudget(), while the changed DMX channels are collected in the frame-based mode and
+   * output at the rate set via setFrameRate(), based on mididmxbridge::IClock::micros() of the
+   * serial interface. A running crossfade, a pending scene refresh and a pending save of the scenes
+   * are advanced once per frame. The input latency is therefore bounded by the loop time of the
+   * sketch, the output jitter by the duration of a single poll() call.
+   *
+   * The frame-based mode is enabled on the first call, see setFrameMode(). Frames missed due to a
+   * stalled loop are dropped instead of being output back to back.
+   *
+   * Only available if the library is compiled with ::MIDIDMXBRIDGE_USE_FRAME_MODE set to 1.
+   *
+   * This function should be used in the Arduino sketch in loop() instead of listen().
+   *
+   */
+  void poll() {
+#if MIDIDMXBRIDGE_STATS
+    const uint32_t start_us = mSerial.micros();
+#endif
+
+    if (!mDmx.isFrameMode()) {
+      mDmx.setFrameMode(true);
+    }
+
+    ingest();
+
+    const uint32_t now_us = mSerial.micros();
+    const uint32_t elapsed_us = now_us - mFrameStartUs;
+
+    if (elapsed_us >= mFramePeriodUs) {
+      const bool isLate = (elapsed_us - mFramePeriodUs) >= mFramePeriodUs;
+      mFrameStartUs = isLate ? now_us : (mFrameStartUs + mFramePeriodUs);  // keep the rate exact
+      outputFrame();
+    }
+#if MIDIDMXBRIDGE_STATS
+    updateStats(mSerial.micros() - start_us);
+#endif
+  }
+#endif
+
+#if MIDIDMXBRIDGE_STATS
+  /**
+   * @brief Get a snapshot of the runtime statistics.
+   *
+   * The statistics are only available if the library is compiled with ::MIDIDMXBRIDGE_STATS set to
+   * 1, otherwise neither memory nor CPU time is spent on them. The loop time is measured via
+   * mididmxbridge::IClock::micros() of the serial interface.
+   *
+   * This function can always be called, e.g. to print the statistics over the USB serial port.
+   *
+   * @return MidiDmxBridgeStats - the statistics since the last resetStats() call
+   */
+  MidiDmxBridgeStats stats() const {
+    const MidiDmxBridgeStats returnValue = {mMessages,
+                                            mReader.parser().droppedBytes(),
+                                            mReader.parser().resyncs(),
+                                            mOverflows,
+                                            mDmx.callbackCount(),
+                                            mLoops,
+                                            mMaxLoopUs,
+                                            mLoopUsSum >> kLoopAverageShift};
+
+    return returnValue;
+  }
+
+  /**
+   * @brief Reset all runtime statistics to 0.
+   *
+   * This function can always be called.
+   *
+   */
+  void resetStats() {
+    mReader.resetStats();
+    mDmx.resetStats();
+    mMessages = 0;
+    mOverflows = 0;
+    mLoops = 0;
+    mMaxLoopUs = 0;
+    mLoopUsSum = 0;
+  }
+#endif
 
  private:
-  mididmxbridge::ISleep& mSleep; /**< the sleep handler object */
-  Dmx mDmx;                      /**< the DMX handler object */
-  MidiReader mReader;            /**< the MIDI reader object */
+#if MIDIDMXBRIDGE_STATS
+  static constexpr uint8_t kLoopAverageShift = 3; /**< the moving average spans 8 listen() calls */
+#endif
+
+#if MIDIDMXBRIDGE_USE_FRAME_MODE
+  /**
+   * @brief Convert a frame rate to the frame period.
+   *
+   * @param[in] rate_hz the number of DMX frames per second, 0 for no fixed rate
+   * @return uint32_t - the frame period in µs
+   */
+  static uint32_t framePeriod(const uint8_t rate_hz) {
+    return (rate_hz > 0) ? (1000000UL / rate_hz) : 0;
+  }
+#endif
+
+  /**
+   * @brief Decode the available MIDI CC messages up to the listen budget and update the DMX state.
+   *
+   */
+  void ingest() {
+    uint8_t controller;
+    uint8_t value;
+    uint8_t channel;
+
+    for (uint8_t msg = 0; (msg < mListenBudget) && mReader.readCc(controller, value, channel);
+         msg++) {
+      if (!mUseCoalescing || !mDmx.isCoalescable(controller)) {
+        flushCoalesced();  // keep the order of stateful messages
+        mDmx.setMidiCcValue(controller, value, channel);
+      } else if (!mCoalescer.add(controller, value, channel)) {
+        flushCoalesced();
+        mCoalescer.add(controller, value, channel);
+      }
+#if MIDIDMXBRIDGE_STATS
+      mMessages++;
+#endif
+    }
+    flushCoalesced();
+  }
+
+  /**
+   * @brief Advance the time-based DMX tasks and output the changed DMX channels.
+   *
+   */
+  void outputFrame() {
+    const uint32_t now_ms = mSerial.millis();
+
+    mDmx.fade(now_ms);
+    mDmx.refresh();
+#if MIDIDMXBRIDGE_USE_FRAME_MODE
+    mDmx.flush();
+#endif
+#if MIDIDMXBRIDGE_USE_SINKS
+    mDmx.serviceSinks(now_ms);
+#endif
+    mDmx.persist(now_ms);
+  }
+
+  /**
+   * @brief Convert the coalesced MIDI CC messages to DMX and clear the batch.
+   *
+   */
+  void flushCoalesced() {
+    for (uint8_t idx = 0; idx < mCoalescer.size(); idx++) {
+      const mididmxbridge::midi::CcUpdate& update = mCoalescer[idx];
+      mDmx.setMidiCcValue(update.controller, update.value, update.midiChannel);
+    }
+    mCoalescer.clear();
+  }
+
+#if MIDIDMXBRIDGE_STATS
+  /**
+   * @brief Account a completed listen() call in the runtime statistics.
+   *
+   * @param[in] elapsed_us the duration of the listen() call in µs
+   */
+  void updateStats(const uint32_t elapsed_us) {
+    if (0 == mLoops) {
+      mLoopUsSum = elapsed_us << kLoopAverageShift;
+    } else {
+      mLoopUsSum = mLoopUsSum - (mLoopUsSum >> kLoopAverageShift) + elapsed_us;
+    }
+
+    if (mSerial.overflow()) {
+      mOverflows++;
+    }
+
+    mLoops++;
+    mMaxLoopUs = mididmxbridge::util::max_t(mMaxLoopUs, elapsed_us);
+  }
+#endif
+
+  Reader& mSerial;                 /**< the serial interface, its clock and sleep handler */
+  Dmx mDmx;                        /**< the DMX handler object */
+  GainFilter mGainFilter;          /**< the conditioning of the attenuation input */
+  BasicMidiReader<Reader> mReader; /**< the MIDI reader object */
+  CcCoalescer mCoalescer;          /**< the latest MIDI CC values of the current batch */
+  bool mUseCoalescing;             /**< true to coalesce redundant MIDI CC messages */
+  uint8_t mListenBudget;           /**< the maximum number of MIDI CC messages per listen() */
+  uint16_t mIdleSleep;             /**< the sleep time in ms if no data is pending */
+#if MIDIDMXBRIDGE_USE_FRAME_MODE
+  uint32_t mFramePeriodUs; /**< the period of the DMX frames of poll() in µs */
+  uint32_t mFrameStartUs;  /**< the start time of the current frame of poll() in µs */
+#endif
+#if MIDIDMXBRIDGE_STATS
+  uint32_t mMessages;  /**< the number of MIDI CC messages decoded */
+  uint32_t mOverflows; /**< the number of overflows of the serial input buffer */
+  uint32_t mLoops;     /**< the number of listen() calls */
+  uint32_t mMaxLoopUs; /**< the longest listen() call in µs */
+  uint32_t mLoopUsSum; /**< the moving sum of the listen() duration in µs */
+#endif
 };
+
+/**
+ * @brief Definition of the bridge using the abstract mididmxbridge::ISerialReader interface.
+ *
+ * This is the class used by the Arduino examples, i.e. any implementation of
+ * mididmxbridge::ISerialReader can be passed as serial interface.
+ *
+ */
+using MidiDmxBridge = BasicMidiDmxBridge<ISerialReader>;
+
+extern template class BasicMidiDmxBridge<ISerialReader>;
 #endif
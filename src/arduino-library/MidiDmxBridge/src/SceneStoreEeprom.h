@@ -0,0 +1,81 @@
+/**
+ * @file SceneStoreEeprom.h
+ * @author Christian Neukam
+ * @brief EEPROM implementation of the mididmxbridge::ISceneStore interface.
+ * @version 1.0
+ * @date 2024-03-12
+ *
+ * @copyright Copyright 2024 Christian Neukam. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef __MIDIDMXBRIDGE_SCENE_STORE_EEPROM_H__
+#define __MIDIDMXBRIDGE_SCENE_STORE_EEPROM_H__
+
+#if defined(ARDUINO) && defined(__AVR__)
+#include <Arduino.h>
+#include <avr/eeprom.h>
+
+#include "ISceneStore.h"
+
+/**
+ * @brief EEPROM implementation of the mididmxbridge::ISceneStore interface.
+ *
+ * The scenes are stored in the internal EEPROM of the AVR microcontroller, starting at an offset,
+ * which leaves the EEPROM below the offset to the Arduino sketch. A byte is only written if its
+ * value changes, and writing does not wait for the EEPROM to complete the write cycle of about
+ * 3.3 ms, i.e. the loop is only blocked if two bytes are written back to back. Addresses beyond
+ * the end of the EEPROM are never written, i.e. the address cannot wrap around.
+ *
+ */
+class SceneStoreEeprom final : public mididmxbridge::ISceneStore {
+ public:
+  /**
+   * @brief Construct a new SceneStoreEeprom object.
+   *
+   * @param[in] offset the EEPROM address of the first byte of the scenes
+   */
+  SceneStoreEeprom(const uint16_t offset = 0) : mOffset(offset) {}
+
+  /**
+   * @brief Destroy the SceneStoreEeprom object
+   *
+   */
+  ~SceneStoreEeprom() = default;
+
+  uint16_t length() override { return (mOffset <= E2END) ? (E2END + 1 - mOffset) : 0; }
+
+  uint8_t read(const uint16_t address) override {
+    return eeprom_read_byte((const uint8_t*)(mOffset + address));
+  }
+
+  void readBytes(const uint16_t address, uint8_t* dst, const uint16_t size) override {
+    eeprom_read_block(dst, (const void*)(mOffset + address), size);
+  }
+
+  bool update(const uint16_t address, const uint8_t value) override {
+    uint8_t* cell = (uint8_t*)(mOffset + address);
+    const bool returnValue = (address < length()) && (eeprom_read_byte(cell) != value);
+
+    if (returnValue) {
+      eeprom_write_byte(cell, value);  // only waits for the previous write cycle
+    }
+
+    return returnValue;
+  }
+
+ private:
+  uint16_t mOffset; /**< the EEPROM address of the first byte of the scenes */
+};
+#endif
+#endif
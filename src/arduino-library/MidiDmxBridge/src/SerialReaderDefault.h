@@ -27,6 +27,7 @@
 #include <SoftwareSerial.h>
 
 #include "ISerialReader.h"
+#include "IdleSleep.h"
 
 #if defined(__AVR_ATmega1280__) || defined(__AVR_ATmega2560__) || defined(__AVR_ATmega32U4__)
 #define kRxPin 10 /**< the software serial RX pin */
@@ -58,10 +59,13 @@
  *  - ::kRxPin (2) for receiving data bytes
  *  - ::kTxPin (3) for sending data, not used
  *
+ * The idle sleep of listen() keeps the CPU in the idle sleep mode until the pin change interrupt of
+ * the software serial adapter received a byte, see mididmxbridge::idleSleep().
+ *
  * @see https://docs.arduino.cc/learn/built-in-libraries/software-serial/
  *
  */
-class SerialReaderDefault : public mididmxbridge::ISerialReader {
+class SerialReaderDefault final : public mididmxbridge::ISerialReader {
  public:
   /**
    * @brief Construct a new SerialReaderDefault object.
@@ -99,7 +103,19 @@ class SerialReaderDefault : public mididmxbridge::ISerialReader {
 
   int read() override { return mSoftSerial.read(); }
 
-  void sleep(uint16_t sleep_ms) override { delay(sleep_ms); }
+  size_t readBytes(uint8_t* dst, const size_t max) override {
+    size_t count = 0;
+
+    while ((count < max) && (mSoftSerial.available() > 0)) {
+      dst[count++] = (uint8_t)mSoftSerial.read();
+    }
+
+    return count;
+  }
+
+  void sleep(uint16_t sleep_ms) override { mididmxbridge::idleSleep(*this, sleep_ms); }
+
+  bool overflow() override { return mSoftSerial.overflow(); }
 
  private:
   const uint8_t mRxPin;       /**< the receiving input pin */
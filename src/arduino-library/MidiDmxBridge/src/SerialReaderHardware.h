@@ -0,0 +1,171 @@
+/**
+ * @file SerialReaderHardware.h
+ * @author Christian Neukam
+ * @brief Interrupt-driven hardware UART implementation of the MidiDmxBridge::ISerialReader
+ * interface.
+ * @version 1.0
+ * @date 2024-02-10
+ *
+ * @copyright Copyright 2024 Christian Neukam. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef __MIDIDMXBRIDGE_SERIAL_READER_HARDWARE_H__
+#define __MIDIDMXBRIDGE_SERIAL_READER_HARDWARE_H__
+
+#if defined(ARDUINO) && defined(__AVR__)
+#include <Arduino.h>
+#include <avr/interrupt.h>
+#include <avr/io.h>
+
+#include "ISerialReader.h"
+#include "IdleSleep.h"
+#include "midi_dmx/RingBuffer.h"
+
+#if defined(UDR1)
+#define kMidiUdr UDR1                     /**< the USART data register */
+#define kMidiUbrr UBRR1                   /**< the USART baud rate register */
+#define kMidiUcsrA UCSR1A                 /**< the USART control and status register A */
+#define kMidiUcsrB UCSR1B                 /**< the USART control and status register B */
+#define kMidiUcsrC UCSR1C                 /**< the USART control and status register C */
+#define kMidiRxEnable RXEN1               /**< the USART receiver enable bit */
+#define kMidiRxInterrupt RXCIE1           /**< the USART receive complete interrupt enable bit */
+#define kMidiCharSize0 UCSZ10             /**< the USART character size bit 0 */
+#define kMidiCharSize1 UCSZ11             /**< the USART character size bit 1 */
+#define kMidiUsartRxVector USART1_RX_vect /**< the USART receive complete interrupt vector */
+#else
+#define kMidiUdr UDR0           /**< the USART data register */
+#define kMidiUbrr UBRR0         /**< the USART baud rate register */
+#define kMidiUcsrA UCSR0A       /**< the USART control and status register A */
+#define kMidiUcsrB UCSR0B       /**< the USART control and status register B */
+#define kMidiUcsrC UCSR0C       /**< the USART control and status register C */
+#define kMidiRxEnable RXEN0     /**< the USART receiver enable bit */
+#define kMidiRxInterrupt RXCIE0 /**< the USART receive complete interrupt enable bit */
+#define kMidiCharSize0 UCSZ00   /**< the USART character size bit 0 */
+#define kMidiCharSize1 UCSZ01   /**< the USART character size bit 1 */
+#if defined(USART_RX_vect)
+#define kMidiUsartRxVector USART_RX_vect /**< the USART receive complete interrupt vector */
+#else
+#define kMidiUsartRxVector USART0_RX_vect /**< the USART receive complete interrupt vector */
+#endif
+#endif
+
+/**
+ * @brief Define the receive interrupt service routine forwarding to a SerialReaderHardware object.
+ *
+ * This macro must be used exactly once in the Arduino sketch, e.g.
+ * `MIDIDMXBRIDGE_SERIAL_READER_HARDWARE_ISR(reader)`.
+ *
+ * @param reader the SerialReaderHardware object receiving the MIDI data
+ */
+#define MIDIDMXBRIDGE_SERIAL_READER_HARDWARE_ISR(reader) \
+  ISR(kMidiUsartRxVector) { reader.onReceive(); }
+
+/**
+ * @brief Interrupt-driven hardware UART implementation of the mididmxbridge::ISerialReader
+ * interface.
+ *
+ * In contrast to SerialReaderDefault, the MIDI data is received by the hardware UART. The receive
+ * complete interrupt stores every byte in a lock-free mididmxbridge::RingBuffer, which is drained
+ * by the MidiDmxBridge library from the main loop. No CPU time is spent on bit-banging and the
+ * interrupts stay enabled, so the DMX timing is not disturbed.
+ *
+ * The following UART is used depending on the Arduino board:
+ *
+ * Mega, Mega 2560, Leonardo and Micro:
+ *  - USART1 (Serial1), pin RX1
+ *
+ * other Arduino boards, e.g. Uno, Pro and Pro Mini:
+ *  - USART0 (Serial), pin RX0. The DMX output must then be moved away from USART0.
+ *
+ * The used UART must not be used by any other library or via the Arduino Serial API, as the
+ * interrupt service routine is defined via MIDIDMXBRIDGE_SERIAL_READER_HARDWARE_ISR() in the
+ * Arduino sketch.
+ *
+ * The idle sleep of listen() keeps the CPU in the idle sleep mode until the receive interrupt
+ * stored a byte, see mididmxbridge::idleSleep().
+ *
+ * @tparam N the size of the receive ring buffer, must be a power of two in the range [2, 256]
+ */
+template <uint16_t N = 128>
+class SerialReaderHardware final : public mididmxbridge::ISerialReader {
+ public:
+  /**
+   * @brief Construct a new SerialReaderHardware object.
+   *
+   */
+  SerialReaderHardware() : mBuffer(), mIsOverflow(false) {}
+
+  /**
+   * @brief Destroy the SerialReaderHardware object
+   *
+   */
+  ~SerialReaderHardware() = default;
+
+  void begin() override {
+    const uint16_t baudRate = 31250;
+
+    kMidiUbrr = (F_CPU / (16UL * baudRate)) - 1;
+    kMidiUcsrA = 0;
+    kMidiUcsrC = (1 << kMidiCharSize1) | (1 << kMidiCharSize0);  // 8N1
+    kMidiUcsrB = (1 << kMidiRxEnable) | (1 << kMidiRxInterrupt);
+  }
+
+  int available() override { return mBuffer.size(); }
+
+  int read() override {
+    uint8_t value = 0;
+    return mBuffer.pop(value) ? value : -1;
+  }
+
+  size_t readBytes(uint8_t* dst, const size_t max) override { return mBuffer.pop(dst, max); }
+
+  void sleep(uint16_t sleep_ms) override { mididmxbridge::idleSleep(*this, sleep_ms); }
+
+  bool overflow() override {
+    const uint8_t sreg = SREG;
+
+    cli();  // the receive interrupt must not set the flag between reading and clearing it
+    const bool returnValue = mIsOverflow;
+    mIsOverflow = false;
+    SREG = sreg;
+
+    return returnValue;
+  }
+
+  /**
+   * @brief Store the received byte in the ring buffer.
+   *
+   * This function must only be called by the receive interrupt service routine, see
+   * MIDIDMXBRIDGE_SERIAL_READER_HARDWARE_ISR().
+   *
+   */
+  void onReceive() {
+    if (!mBuffer.push(kMidiUdr)) {
+      mIsOverflow = true;
+    }
+  }
+
+  /**
+   * @brief Returns the number of bytes discarded because the ring buffer was full.
+   *
+   * @return uint8_t - the number of discarded bytes, wraps around at 256
+   */
+  uint8_t dropped() const { return mBuffer.dropped(); }
+
+ private:
+  mididmxbridge::RingBuffer<uint8_t, N> mBuffer; /**< the receive ring buffer */
+  volatile bool mIsOverflow;                     /**< set by the ISR if a byte got discarded */
+};
+#endif
+#endif
@@ -0,0 +1,139 @@
+/**
+ * @file Bitmap.h
+ * @author Christian Neukam
+ * @brief Definition of the mididmxbridge::Bitmap class template.
+ * @version 1.0
+ * @date 2024-02-17
+ *
+ * @copyright Copyright 2024 Christian Neukam. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef __MIDIDMXBRIDGE_BITMAP_H__
+#define __MIDIDMXBRIDGE_BITMAP_H__
+
+#include <stdint.h>
+
+namespace mididmxbridge {
+/**
+ * @brief This class provides a compact fixed-size set of bits, e.g. to flag DMX channels.
+ *
+ * The bits are packed into bytes, i.e. a bitmap of 128 bits occupies 16 bytes. Positions outside
+ * the range [0, N - 1] are ignored.
+ *
+ * @tparam N the number of bits
+ */
+template <uint16_t N>
+class Bitmap {
+ public:
+  /**
+   * @brief Construct a new Bitmap object with all bits cleared.
+   *
+   */
+  Bitmap() : mBits() {}
+
+  /**
+   * @brief Set the bit at the given position.
+   *
+   * @param[in] pos the position of the bit
+   */
+  void set(const uint16_t pos) {
+    if (pos < N) {
+      mBits[pos >> 3] |= (uint8_t)(1 << (pos & 0x07));
+    }
+  }
+
+  /**
+   * @brief Clear the bit at the given position.
+   *
+   * @param[in] pos the position of the bit
+   */
+  void reset(const uint16_t pos) {
+    if (pos < N) {
+      mBits[pos >> 3] &= (uint8_t)~(1 << (pos & 0x07));
+    }
+  }
+
+  /**
+   * @brief Clear all bits.
+   *
+   */
+  void clear() {
+    for (uint16_t idx = 0; idx < kBytes; idx++) {
+      mBits[idx] = 0;
+    }
+  }
+
+  /**
+   * @brief Get the bit at the given position.
+   *
+   * @param[in] pos the position of the bit
+   * @return true - the bit is set
+   * @return false - otherwise or if \p pos is out of range
+   */
+  bool test(const uint16_t pos) const {
+    return (pos < N) ? (mBits[pos >> 3] & (1 << (pos & 0x07))) != 0 : false;
+  }
+
+  /**
+   * @brief Check whether any bit is set.
+   *
+   * @return true - at least one bit is set
+   * @return false - otherwise
+   */
+  bool any() const {
+    bool returnValue = false;
+
+    for (uint16_t idx = 0; (idx < kBytes) && !returnValue; idx++) {
+      returnValue = (mBits[idx] != 0);
+    }
+
+    return returnValue;
+  }
+
+  /**
+   * @brief Find the next set bit, starting at the given position.
+   *
+   * Whole bytes without any set bit are skipped at once.
+   *
+   * @param[in] pos the position to start the search at
+   * @return uint16_t - the position of the next set bit, N if there is none
+   */
+  uint16_t next(uint16_t pos) const {
+    while (pos < N) {
+      if (mBits[pos >> 3] == 0) {
+        pos = (pos | 0x07) + 1;  // skip the remaining bits of an empty byte
+      } else if (test(pos)) {
+        break;
+      } else {
+        pos++;
+      }
+    }
+
+    return (pos < N) ? pos : N;
+  }
+
+  /**
+   * @brief Returns the number of bits.
+   *
+   * @return uint16_t - the number of bits
+   */
+  constexpr uint16_t size() const { return N; }
+
+ private:
+  static constexpr uint16_t kBytes = (N + 7) / 8; /**< the number of bytes occupied */
+
+  uint8_t mBits[kBytes]; /**< the packed bits */
+};
+}  // namespace mididmxbridge
+#endif
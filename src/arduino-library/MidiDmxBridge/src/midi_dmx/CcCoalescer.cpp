@@ -0,0 +1,54 @@
+/**
+ * @file CcCoalescer.cpp
+ * @author Christian Neukam
+ * @brief Implementation of the mididmxbridge::midi::CcCoalescer class
+ * @version 1.0
+ * @date 2024-03-11
+ *
+ * @copyright Copyright 2024 Christian Neukam. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "CcCoalescer.h"
+
+namespace mididmxbridge::midi {
+CcCoalescer::CcCoalescer() : mUpdates() {}
+
+bool CcCoalescer::add(const uint8_t controller, const uint8_t value, const uint8_t midiChannel) {
+  bool returnValue = false;
+
+  for (uint8_t idx = 0; !returnValue && (idx < mUpdates.size()); idx++) {
+    CcUpdate& update = mUpdates[idx];
+
+    if ((update.controller == controller) && (update.midiChannel == midiChannel)) {
+      update.value = value;
+      returnValue = true;
+    }
+  }
+
+  if (!returnValue && !mUpdates.full()) {
+    mUpdates.push_back(CcUpdate{controller, value, midiChannel});
+    returnValue = true;
+  }
+
+  return returnValue;
+}
+
+void CcCoalescer::clear() { mUpdates.clear(); }
+
+bool CcCoalescer::empty() const { return mUpdates.empty(); }
+
+uint8_t CcCoalescer::size() const { return mUpdates.size(); }
+
+const CcUpdate& CcCoalescer::operator[](const uint8_t pos) const { return mUpdates[pos]; }
+}  // namespace mididmxbridge::midi
@@ -0,0 +1,107 @@
+/**
+ * @file CcCoalescer.h
+ * @author Christian Neukam
+ * @brief Definition of the mididmxbridge::midi::CcCoalescer class
+ * @version 1.0
+ * @date 2024-03-11
+ *
+ * @copyright Copyright 2024 Christian Neukam. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef __MIDIDMXBRIDGE_CC_COALESCER_H__
+#define __MIDIDMXBRIDGE_CC_COALESCER_H__
+
+#include <stdint.h>
+
+#include "constants.h"
+#include "static_vector.h"
+
+namespace mididmxbridge::midi {
+/**
+ * @brief This struct defines a MIDI CC update.
+ *
+ */
+struct CcUpdate {
+  uint8_t controller;  /**< the MIDI CC controller */
+  uint8_t value;       /**< the latest MIDI CC value */
+  uint8_t midiChannel; /**< the MIDI channel in the range [1, 16] */
+};
+
+/**
+ * @brief This class coalesces redundant MIDI CC updates of a batch.
+ *
+ * The table keeps the latest value per MIDI channel and controller, i.e. intermediate values a
+ * controller sends several times within a batch are dropped. The updates are kept in the order of
+ * their first occurrence. The table holds up to ::MIDIDMXBRIDGE_COALESCE_SIZE distinct
+ * controllers in 3 bytes each.
+ *
+ */
+class CcCoalescer {
+ public:
+  /**
+   * @brief Construct a new, empty CcCoalescer object.
+   *
+   */
+  CcCoalescer();
+
+  /**
+   * @brief Add a MIDI CC update to the batch.
+   *
+   * If the batch already holds an update of the controller on the MIDI channel, only its value is
+   * replaced.
+   *
+   * @param[in] controller the MIDI CC controller
+   * @param[in] value the MIDI CC value
+   * @param[in] midiChannel the MIDI channel in the range [1, 16]
+   * @return true - the update got added or merged
+   * @return false - the table is full, the update got discarded
+   */
+  bool add(const uint8_t controller, const uint8_t value, const uint8_t midiChannel);
+
+  /**
+   * @brief Remove all updates.
+   *
+   */
+  void clear();
+
+  /**
+   * @brief Checks if the batch holds no updates.
+   *
+   * @return true if the batch is empty
+   * @return false otherwise
+   */
+  bool empty() const;
+
+  /**
+   * @brief Returns the number of distinct updates.
+   *
+   * @return uint8_t - the number of updates
+   */
+  uint8_t size() const;
+
+  /**
+   * @brief Returns the update at the specified location.
+   *
+   * @warning No bounds checking is performed.
+   *
+   * @param[in] pos the position of the update in the order of first occurrence
+   * @return const CcUpdate& - the update
+   */
+  const CcUpdate& operator[](const uint8_t pos) const;
+
+ private:
+  static_vector<CcUpdate, kCoalesceSize> mUpdates; /**< the latest updates of the batch */
+};
+}  // namespace mididmxbridge::midi
+#endif
@@ -43,6 +43,11 @@ bool ContinuousController::operator!=(const ContinuousController& rhs) const {
   return !(*this == rhs);
 }
 
+uint16_t ContinuousController::toDmx16(const uint16_t value) {
+  const uint16_t value14 = value & 0x3fff;
+  return (uint16_t)((value14 << 2) | (value14 >> 12));
+}
+
 DmxValue ContinuousController::toDmx() const {
   const uint8_t value = mValue * kMidiToDmxFactor;
   return {mController, value};
@@ -63,7 +63,7 @@ class ContinuousController {
    * @brief Destroy the ContinuousController object.
    *
    */
-  virtual ~ContinuousController() = default;
+  ~ContinuousController() = default;
 
   /**
    * @brief Compare operator for a ContinuousController object.
@@ -90,6 +90,19 @@ class ContinuousController {
    */
   DmxValue toDmx() const;
 
+  /**
+   * @brief Convert a 14-bit MIDI value to a 16-bit DMX value.
+   *
+   * The 14 bits are shifted to the top and the two most significant bits are replicated into the
+   * two free bits, i.e. 0 and 16383 are converted to 0 and 65535. The upper byte is the 8-bit DMX
+   * value covering the full range [0, 255], the lower byte the fine value of a 16-bit DMX channel
+   * pair. Only shifts are used, no multiplication or division.
+   *
+   * @param[in] value the 14-bit MIDI value in the range [0, 16383], higher bits are ignored
+   * @return uint16_t - the 16-bit DMX value
+   */
+  static uint16_t toDmx16(const uint16_t value);
+
  private:
   const uint8_t mController; /**< the MIDI CC controller */
   const uint8_t mValue;      /**< the MIDI CC value */
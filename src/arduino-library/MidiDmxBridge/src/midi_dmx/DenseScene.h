@@ -0,0 +1,193 @@
+/**
+ * @file DenseScene.h
+ * @author Christian Neukam
+ * @brief Definition of the mididmxbridge::dmx::DenseScene class templates.
+ * @version 1.0
+ * @date 2024-02-24
+ *
+ * @copyright Copyright 2024 Christian Neukam. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef __MIDIDMXBRIDGE_DENSE_SCENE_H__
+#define __MIDIDMXBRIDGE_DENSE_SCENE_H__
+
+#include <stdint.h>
+
+#include "Bitmap.h"
+
+namespace mididmxbridge::dmx {
+/**
+ * @brief This class defines a DMX scene stored as a dense, channel-indexed array of values.
+ *
+ * In contrast to a list of mididmxbridge::dmx::DmxValue objects, the channel is given by the
+ * position in the array and whether a channel is part of the scene is stored in a bitmap. A scene
+ * of 128 channels therefore occupies 144 bytes without any virtual members or heap allocation.
+ *
+ * Channels outside the range [0, N - 1] are ignored.
+ *
+ * @tparam N the number of DMX channels
+ */
+template <uint16_t N>
+class DenseScene {
+ public:
+  /**
+   * @brief Construct a new, empty DenseScene object.
+   *
+   */
+  DenseScene() : mValues(), mIsSet() {}
+
+  /**
+   * @brief Assign a value to a DMX channel and add the channel to the scene.
+   *
+   * @param[in] channel the DMX channel
+   * @param[in] value the DMX value
+   * @return true - the scene got changed
+   * @return false - otherwise, i.e. the channel already had this value or is out of range
+   */
+  bool set(const uint16_t channel, const uint8_t value) {
+    bool returnValue = false;
+
+    if (channel < N) {
+      returnValue = !mIsSet.test(channel) || (mValues[channel] != value);
+      mValues[channel] = value;
+      mIsSet.set(channel);
+    }
+
+    return returnValue;
+  }
+
+  /**
+   * @brief Remove all channels from the scene.
+   *
+   */
+  void clear() {
+    for (uint16_t idx = 0; idx < N; idx++) {
+      mValues[idx] = 0;
+    }
+    mIsSet.clear();
+  }
+
+  /**
+   * @brief Check whether a DMX channel is part of the scene.
+   *
+   * @param[in] channel the DMX channel
+   * @return true - the channel got assigned a value
+   * @return false - otherwise
+   */
+  bool isSet(const uint16_t channel) const { return mIsSet.test(channel); }
+
+  /**
+   * @brief Get the value of a DMX channel.
+   *
+   * @param[in] channel the DMX channel
+   * @return uint8_t - the DMX value, 0 if the channel is not part of the scene
+   */
+  uint8_t value(const uint16_t channel) const { return (channel < N) ? mValues[channel] : 0; }
+
+  /**
+   * @brief Find the next DMX channel that is part of the scene.
+   *
+   * @param[in] channel the DMX channel to start the search at
+   * @return uint16_t - the next DMX channel of the scene, N if there is none
+   */
+  uint16_t next(const uint16_t channel) const { return mIsSet.next(channel); }
+
+  /**
+   * @brief Get the raw values of all DMX channels, e.g. to process the scene as a whole frame.
+   *
+   * @return const uint8_t* - the N values indexed by channel, 0 for channels not part of the scene
+   */
+  const uint8_t* values() const { return mValues; }
+
+  /**
+   * @brief Returns the number of DMX channels the scene is able to hold.
+   *
+   * @return uint16_t - the number of DMX channels
+   */
+  constexpr uint16_t size() const { return N; }
+
+ private:
+  uint8_t mValues[N]; /**< the DMX values indexed by channel */
+  Bitmap<N> mIsSet;   /**< the channels that are part of the scene */
+};
+
+/**
+ * @brief This class defines a dense DMX scene that additionally records its 16-bit value pairs.
+ *
+ * A 16-bit value occupies a coarse channel and the following fine channel. The pairs are stored
+ * next to the values, so they belong to this scene only and get removed together with it. The
+ * raw image of the base class remains unchanged, i.e. the pairs are not persisted.
+ *
+ * @tparam N the number of DMX channels
+ */
+template <uint16_t N>
+class PairedScene : public DenseScene<N> {
+ public:
+  /**
+   * @brief Construct a new, empty PairedScene object.
+   *
+   */
+  PairedScene() : DenseScene<N>(), mIsFine() {}
+
+  /**
+   * @brief Remove all channels and all 16-bit pairs from the scene.
+   *
+   */
+  void clear() {
+    DenseScene<N>::clear();
+    mIsFine.clear();
+  }
+
+  /**
+   * @brief Mark a DMX channel as the fine channel of a 16-bit value, or unmark it.
+   *
+   * @param[in] channel the fine DMX channel, the coarse channel is the preceding one
+   * @param[in] isFine true - the channel is a fine channel, false - it is output on its own
+   */
+  void setFine(const uint16_t channel, const bool isFine) {
+    if (isFine) {
+      mIsFine.set(channel);
+    } else {
+      mIsFine.reset(channel);
+    }
+  }
+
+  /**
+   * @brief Remove all 16-bit pairs, but keep the values of the scene.
+   *
+   */
+  void clearFine() { mIsFine.clear(); }
+
+  /**
+   * @brief Check whether a DMX channel is the fine channel of a 16-bit value.
+   *
+   * @param[in] channel the DMX channel
+   * @return true - the channel is the fine channel of a 16-bit value
+   * @return false - otherwise
+   */
+  bool isFine(const uint16_t channel) const { return mIsFine.test(channel); }
+
+  /**
+   * @brief Find the next fine channel of a 16-bit value.
+   *
+   * @param[in] channel the DMX channel to start the search at
+   * @return uint16_t - the next fine DMX channel, N if there is none
+   */
+  uint16_t nextFine(const uint16_t channel) const { return mIsFine.next(channel); }
+
+ private:
+  Bitmap<N> mIsFine; /**< the fine channels of 16-bit DMX values */
+};
+}  // namespace mididmxbridge::dmx
+#endif
@@ -22,6 +22,11 @@
 #include "Dmx.h"
 
 #include "ContinuousController.h"
+#include "FrameKernels.h"
+#if MIDIDMXBRIDGE_USE_HIGH_RES
+#include "HighResDecoder.h"
+#endif
+#include "ResponseCurve.h"
 #include "constants.h"
 #include "util.h"
 
@@ -29,100 +34,469 @@ namespace mididmxbridge::dmx {
 using namespace mididmxbridge::util;
 
 using midi::ContinuousController;
+#if MIDIDMXBRIDGE_USE_HIGH_RES
+using midi::HighResDecoder;
+using midi::HighResValue;
+#endif
 
 static const uint16_t kGainDeadZone = 5; /**< the offset specifying the dead zone for gain values */
+static const uint16_t kFadeLevelMax = 256; /**< the fade level of the completed crossfade */
 
 Dmx::Dmx(DmxOnChangeCallback callback)
     : mUseDynamicScene(true),
-      mDynamicScene(kMaxMidiValue),
+#if MIDIDMXBRIDGE_USE_FRAME_MODE
+      mUseFrameMode(false),
+#endif
+      mStaticScenes(),
+      mStaticSlot(0),
+      mDynamicScene(),
+      mPatchMap(),
+      mChannelOffset(),
+#if MIDIDMXBRIDGE_USE_HIGH_RES
+      mResolution(DmxResolution::k7Bit),
+      mDecoder(),
+#endif
+#if MIDIDMXBRIDGE_USE_FRAME_MODE
+      mDirty(),
+#endif
+      mFrame(),
       mGain(kUnityGainValue),
-      mCallback(callback) {}
+      mCurve(DmxCurve::kLinear),
+      mIsFading(false),
+      mIsFadeStarted(false),
+      mIsFinalSweep(false),
+      mFadeTime(0),
+      mFadeLevel(kFadeLevelMax),
+      mFadeCursor(0),
+      mFadeBudget(kDefaultFadeBudget),
+      mFadeStart(0),
+      mLastFade(0),
+      mIsRefreshing(false),
+      mIsRefreshRepeated(false),
+      mRefreshBudget(0),
+      mRefreshCursor(0),
+      mCallback(callback),
+#if MIDIDMXBRIDGE_USE_FRAME_MODE
+      mFrameCallback(nullptr),
+#endif
+#if MIDIDMXBRIDGE_USE_SINKS
+      mSinks(),
+#endif
+      mSceneBank()
+#if MIDIDMXBRIDGE_STATS
+      ,
+      mCallbackCount(0)
+#endif
+{
+  for (uint8_t slot = 0; slot < kStaticSceneSlots; slot++) {
+    mSceneBank.attach(slot, mStaticScenes[slot]);
+  }
+  mSceneBank.attach(kStaticSceneSlots, mDynamicScene);
+  updateGainLut();
+}
 
 uint8_t Dmx::scaleValue(const uint8_t value) const {
-  return ((uint32_t)value * (uint32_t)mGain) >> kAnalogReadBits;
+#if MIDIDMXBRIDGE_USE_GAIN_LUT
+  if (!(value & 0x01)) {
+    return mGainLut[value >> 1];
+  }
+#endif
+  return ((uint32_t)applyCurve(mCurve, value) * (uint32_t)mGain) >> kAnalogReadBits;
+}
+
+void Dmx::updateGainLut() {
+#if MIDIDMXBRIDGE_USE_GAIN_LUT
+  for (uint8_t idx = 0; idx < sizeof(mGainLut); idx++) {
+    const uint8_t value = applyCurve(mCurve, (uint8_t)(idx << 1));
+    mGainLut[idx] = ((uint32_t)value * (uint32_t)mGain) >> kAnalogReadBits;
+  }
+#endif
+}
+
+void Dmx::updateFrame(const uint16_t channel, const uint8_t value) {
+  if (value != mFrame[channel]) {
+    mFrame[channel] = value;
+#if MIDIDMXBRIDGE_USE_SINKS
+    mSinks.markChanged(channel);
+#endif
+  }
+}
+
+void Dmx::refreshScene() {
+  if (mIsFading) {
+    // the crossfade sweep outputs the new gain
+  } else if (mRefreshBudget > 0) {
+    mIsRefreshRepeated = mIsRefreshing && (mRefreshCursor > 0);
+    mIsRefreshing = true;
+  } else {
+    sendScene();
+  }
 }
 
 bool Dmx::updateScene(const DmxValue& dmxValue) {
   bool sceneChanged = false;
 
-  if (dmxValue && (dmxValue.channel() <= kMaxMidiValue)) {
-    sceneChanged = mDynamicScene[dmxValue.channel()] != dmxValue;
-    mDynamicScene[dmxValue.channel()] = dmxValue;
+  if (dmxValue && (dmxValue.channel() <= kMaxDmxChannel)) {
+    sceneChanged = mDynamicScene.set(dmxValue.channel(), dmxValue.value());
+  }
+
+  if (sceneChanged) {
+    mSceneBank.markChanged();
   }
 
   return sceneChanged;
 }
 
-void Dmx::sendScene() const {
-  const auto& scene = mUseDynamicScene ? mDynamicScene : mStaticScene;
+void Dmx::output(const uint16_t channel) {
+#if MIDIDMXBRIDGE_USE_FRAME_MODE
+  if (mUseFrameMode) {
+    mDirty.set(channel);
+  } else {
+    sendValue(channel);
+  }
+#else
+  sendValue(channel);
+#endif
+}
+
+void Dmx::sendValue(const uint16_t channel) {
+  updateFrame(channel, outputValue(channel));
 
   if (mCallback) {
-    for (uint8_t idx = 0; idx < scene.size(); idx++) {
-      const auto& dmxValue = scene[idx];
+    mCallback(channel, mFrame[channel]);
+#if MIDIDMXBRIDGE_STATS
+    mCallbackCount++;
+#endif
+  }
+}
+
+uint8_t Dmx::activeValue(const uint16_t channel) const {
+  uint8_t value = mUseDynamicScene ? mDynamicScene.value(channel) : staticValue(channel);
+
+  if (mIsFading) {
+    const uint16_t from = mUseDynamicScene ? staticValue(channel) : mDynamicScene.value(channel);
+    value = (from * (kFadeLevelMax - mFadeLevel) + value * mFadeLevel) >> 8;
+  }
+
+  return value;
+}
+
+uint8_t Dmx::outputValue(const uint16_t channel) const {
+#if MIDIDMXBRIDGE_USE_HIGH_RES
+  const bool isPaired = isPairOutput();
+  uint8_t returnValue = 0;
+
+  if (isPaired && mDynamicScene.isFine(channel)) {
+    returnValue = (uint8_t)scaleValue16(activeValue16(channel - 1));
+  } else if (isPaired && mDynamicScene.isFine(channel + 1)) {
+    returnValue = (uint8_t)(scaleValue16(activeValue16(channel)) >> 8);
+  } else {
+    returnValue = scaleValue(activeValue(channel));
+  }
+
+  return returnValue;
+#else
+  return scaleValue(activeValue(channel));
+#endif
+}
+
+#if MIDIDMXBRIDGE_USE_HIGH_RES
+
+uint16_t Dmx::activeValue16(const uint16_t channel) const {
+  const Scene& active = mUseDynamicScene ? mDynamicScene : mStaticScenes[mStaticSlot];
+  uint16_t value = (active.value(channel) << 8) | active.value(channel + 1);
+
+  if (mIsFading) {
+    const Scene& other = mUseDynamicScene ? mStaticScenes[mStaticSlot] : mDynamicScene;
+    const uint32_t from = (other.value(channel) << 8) | other.value(channel + 1);
+    value = (from * (kFadeLevelMax - mFadeLevel) + (uint32_t)value * mFadeLevel) >> 8;
+  }
+
+  return value;
+}
+
+bool Dmx::isPairOutput() const { return mUseDynamicScene || (mIsFading && !mIsFinalSweep); }
+
+uint16_t Dmx::scaleValue16(const uint16_t value) const {
+  return ((uint32_t)applyCurve16(mCurve, value) * (uint32_t)mGain) >> kAnalogReadBits;
+}
+#endif
+
+uint8_t Dmx::staticValue(const uint16_t channel) const {
+  return mStaticScenes[mStaticSlot].value(channel);
+}
+
+void Dmx::sendScene() {
+  const Scene& scene = mUseDynamicScene ? mDynamicScene : mStaticScenes[mStaticSlot];
+
+  for (uint16_t ch = scene.next(0); ch < scene.size(); ch = scene.next(ch + 1)) {
+    output(ch);
+  }
+}
+
+#if MIDIDMXBRIDGE_USE_FRAME_KERNELS
+void Dmx::sendChanges(const Scene& scene) {
+  uint8_t target[kMaxDmxChannel + 1];
+  uint8_t changed[(sizeof(target) + 7) >> 3];
 
-      if (dmxValue) {
-        mCallback(dmxValue.channel(), scaleValue(dmxValue.value()));
+  scaleActiveFrame(target);
+  if (diffFrame(target, mFrame, sizeof(target), changed)) {
+    for (uint16_t idx = 0; idx < sizeof(changed); idx++) {
+      for (uint8_t bit = 0; (changed[idx] >> bit) != 0; bit++) {
+        const uint16_t ch = (idx << 3) + bit;
+
+        if (((changed[idx] >> bit) & 0x01) && scene.isSet(ch)) {
+          output(ch);
+        }
       }
     }
   }
 }
 
-void Dmx::blackoutScene() const {
-  const auto& scene = mUseDynamicScene ? mStaticScene : mDynamicScene;
+void Dmx::scaleActiveFrame(uint8_t frame[]) const {
+  const Scene& scene = mUseDynamicScene ? mDynamicScene : mStaticScenes[mStaticSlot];
+  const uint8_t* values = scene.values();
 
-  if (mCallback) {
-    for (uint8_t idx = 0; idx < scene.size(); idx++) {
-      const auto& dmxValue = scene[idx];
+  if (mIsFading) {
+    for (uint16_t ch = 0; ch <= kMaxDmxChannel; ch++) {
+      frame[ch] = activeValue(ch);
+    }
+    values = frame;
+  }
 
-      if (dmxValue) {
-        mCallback(dmxValue.channel(), 0);
-      }
+  if (DmxCurve::kLinear == mCurve) {
+    scaleFrame(values, frame, kMaxDmxChannel + 1, mGain);
+  } else {
+    for (uint16_t ch = 0; ch <= kMaxDmxChannel; ch++) {
+      frame[ch] = scaleValue(values[ch]);
+    }
+  }
+
+#if MIDIDMXBRIDGE_USE_HIGH_RES
+  if (isPairOutput()) {
+    for (uint16_t ch = mDynamicScene.nextFine(0); ch <= kMaxDmxChannel;
+         ch = mDynamicScene.nextFine(ch + 1)) {
+      const uint16_t value = scaleValue16(activeValue16(ch - 1));
+      frame[ch - 1] = (uint8_t)(value >> 8);
+      frame[ch] = (uint8_t)value;
+    }
+  }
+#endif
+}
+#else
+void Dmx::sendChanges(const Scene& scene) {
+  for (uint16_t ch = scene.next(0); ch < scene.size(); ch = scene.next(ch + 1)) {
+    if (outputValue(ch) != mFrame[ch]) {
+      output(ch);
     }
   }
 }
+#endif
 
 void Dmx::setGain(const uint16_t gain) {
   const bool isToSet = (absDiff_t(gain, mGain) > kGainDeadZone) ? true : false;
 
   if (isToSet) {
     mGain = min_t(gain, kUnityGainValue);
-    sendScene();
+    updateGainLut();
+    refreshScene();
+  }
+}
+
+void Dmx::setCurve(const DmxCurve curve) {
+  if (curve != mCurve) {
+    mCurve = curve;
+    updateGainLut();
+    refreshScene();
   }
 }
 
 void Dmx::setDmxValue(const DmxValue& dmxValue) {
-  const bool triggerCallback = updateScene(dmxValue) && mUseDynamicScene;
+  const bool triggerCallback = updateScene(dmxValue) && (mUseDynamicScene || mIsFading);
+
+  if (triggerCallback) {
+    output(dmxValue.channel());
+  }
+}
+
+void Dmx::setMidiCcValue(const uint8_t midiCcController, const uint8_t midiCcValue,
+                         const uint8_t midiChannel) {
+#if MIDIDMXBRIDGE_USE_HIGH_RES
+  HighResValue highRes = {0, 0, false};
+  const bool withFine = (DmxResolution::k16Bit == mResolution);
+  const auto result = (DmxResolution::k7Bit == mResolution)
+                          ? HighResDecoder::Result::kPassThrough
+                          : mDecoder.decode(midiCcController, midiCcValue, midiChannel, highRes);
+
+  if (HighResDecoder::Result::kPassThrough == result) {
+    const DmxValue dmxValue = ContinuousController{midiCcController, midiCcValue}.toDmx();
+    setMappedValue((uint8_t)dmxValue.channel(), midiChannel, (uint16_t)(dmxValue.value() << 8),
+                   false);
+  } else if (HighResDecoder::Result::kValue == result) {
+    const uint16_t value = ContinuousController::toDmx16(highRes.value);
+
+    if (highRes.isNrpn) {
+      setAddressValue(highRes.parameter + channelOffset(midiChannel), value, withFine);
+    } else {
+      setMappedValue((uint8_t)highRes.parameter, midiChannel, value, withFine);
+    }
+  }
+#else
+  const DmxValue dmxValue = ContinuousController{midiCcController, midiCcValue}.toDmx();
+  setMappedValue((uint8_t)dmxValue.channel(), midiChannel, (uint16_t)(dmxValue.value() << 8),
+                 false);
+#endif
+}
 
-  if (mCallback && triggerCallback) {
-    mCallback(dmxValue.channel(), scaleValue(dmxValue.value()));
+void Dmx::setMappedValue(const uint8_t controller, const uint8_t midiChannel, const uint16_t value,
+                         const bool withFine) {
+  if (mPatchMap.empty()) {
+    setAddressValue(controller + channelOffset(midiChannel), value, withFine);
+  } else {
+    for (uint8_t idx = mPatchMap.find(controller, midiChannel, 0); idx < mPatchMap.size();
+         idx = mPatchMap.find(controller, midiChannel, idx + 1)) {
+      setAddressValue(mPatchMap.address(idx), value, withFine);
+    }
   }
 }
 
-void Dmx::setMidiCcValue(const uint8_t midiCcController, const uint8_t midiCcValue) {
-  setDmxValue(ContinuousController{midiCcController, midiCcValue}.toDmx());
+void Dmx::setAddressValue(const uint16_t address, const uint16_t value, const bool withFine) {
+#if MIDIDMXBRIDGE_USE_HIGH_RES
+  const uint16_t fine = address + 1;
+  const bool isPair = withFine && (fine <= kMaxDmxChannel);
+  const bool wasPair = mDynamicScene.isFine(fine);
+  const bool wasFine = mDynamicScene.isFine(address);
+
+  // the coarse and the fine output both depend on the complete 16-bit value
+  mDynamicScene.setFine(address, false);
+  mDynamicScene.setFine(fine, isPair);
+
+  bool isChanged = updateScene(DmxValue{address, (uint8_t)(value >> 8)}) || (isPair != wasPair);
+  if (isPair) {
+    isChanged = updateScene(DmxValue{fine, (uint8_t)value}) || isChanged;
+  }
+
+  if (mUseDynamicScene || mIsFading) {
+    if (wasFine) {
+      output(address - 1);  // the former coarse channel is output on its own again
+    }
+    if (isChanged || wasFine) {
+      output(address);
+    }
+    if (isChanged && (isPair || wasPair)) {
+      output(fine);
+    }
+  }
+#else
+  const bool isChanged = updateScene(DmxValue{address, (uint8_t)(value >> 8)});
+
+  (void)withFine;  // 16-bit values are not supported
+  if (isChanged && (mUseDynamicScene || mIsFading)) {
+    output(address);
+  }
+#endif
+}
+
+uint16_t Dmx::channelOffset(const uint8_t midiChannel) const {
+  const bool isValidChannel = (midiChannel > 0) && (midiChannel <= kMaxMidiChannel);
+  return isValidChannel ? mChannelOffset[midiChannel - 1] : 0;
+}
+
+#if MIDIDMXBRIDGE_USE_HIGH_RES
+void Dmx::setResolution(const DmxResolution resolution) {
+  mResolution = resolution;
+  mDecoder.reset();
+  mDynamicScene.clearFine();
+}
+#endif
+
+bool Dmx::isCoalescable(const uint8_t controller) const {
+#if MIDIDMXBRIDGE_USE_HIGH_RES
+  return (DmxResolution::k7Bit == mResolution) || !HighResDecoder::isStateful(controller);
+#else
+  (void)controller;  // every MIDI CC message is passed through
+  return true;
+#endif
+}
+
+bool Dmx::patch(const uint8_t controller, const uint16_t address, const uint8_t midiChannel) {
+  return mPatchMap.add(controller, address, midiChannel);
+}
+
+void Dmx::clearPatches() { mPatchMap.clear(); }
+
+bool Dmx::setChannelOffset(const uint8_t midiChannel, const uint16_t offset) {
+  const bool returnValue = (midiChannel > 0) && (midiChannel <= kMaxMidiChannel) &&
+                           (offset <= kMaxDmxChannel);
+
+  if (returnValue) {
+    mChannelOffset[midiChannel - 1] = offset;
+  }
+
+  return returnValue;
 }
 
 void Dmx::setStaticScene(const DmxRgbChannels& channels, const DmxRgb& rgb) {
-  setRgbColor(channels.red, rgb.red);
-  setRgbColor(channels.green, rgb.green);
-  setRgbColor(channels.blue, rgb.blue);
+  setStaticScene(mStaticSlot, channels, rgb);
 }
 
-void Dmx::setRgbColor(const vector<uint8_t>& channels, const uint8_t color) {
-  for (uint8_t ch = 0; ch < channels.size(); ch++) {
-    if (channels[ch] <= kMaxMidiValue) {
-      mStaticScene.push_back(DmxValue{channels[ch], color});
+bool Dmx::setStaticScene(const uint8_t slot, const DmxRgbChannels& channels, const DmxRgb& rgb) {
+  const bool returnValue = (slot < kStaticSceneSlots);
+
+  if (returnValue) {
+    setRgbColor(mStaticScenes[slot], channels.red, rgb.red);
+    setRgbColor(mStaticScenes[slot], channels.green, rgb.green);
+    setRgbColor(mStaticScenes[slot], channels.blue, rgb.blue);
+    mSceneBank.markChanged();
+  }
+
+  return returnValue;
+}
+
+bool Dmx::clearStaticScene(const uint8_t slot) {
+  const bool returnValue = (slot < kStaticSceneSlots);
+
+  if (returnValue) {
+    mStaticScenes[slot].clear();
+    mSceneBank.markChanged();
+  }
+
+  return returnValue;
+}
+
+bool Dmx::selectStaticScene(const uint8_t slot) {
+  const bool returnValue = (slot < kStaticSceneSlots);
+
+  if (returnValue && (slot != mStaticSlot)) {
+    const Scene& previous = mStaticScenes[mStaticSlot];
+    mStaticSlot = slot;
+
+    if (!mUseDynamicScene || mIsFading) {
+      sendChanges(previous);
+      sendChanges(mStaticScenes[mStaticSlot]);
     }
   }
+
+  return returnValue;
+}
+
+uint8_t Dmx::staticSceneSlot() const { return mStaticSlot; }
+
+void Dmx::setRgbColor(Scene& scene, const DmxColorChannels& channels, const uint8_t color) {
+  for (uint8_t ch = 0; ch < channels.size(); ch++) {
+    scene.set(channels[ch], color);  // channels out of range are ignored
+  }
 }
 
 void Dmx::activateStaticScene() {
   bool sendCompleteUpdate = mUseDynamicScene;
   mUseDynamicScene = false;
 
-  if (sendCompleteUpdate) {
-    blackoutScene();
-    sendScene();
+  if (sendCompleteUpdate && (mFadeTime > 0)) {
+    startFade();
+  } else if (sendCompleteUpdate) {
+    sendChanges(mStaticScenes[mStaticSlot]);
+    sendChanges(mDynamicScene);
   }
 }
 
@@ -130,9 +504,190 @@ void Dmx::activateDynamicScene() {
   bool sendCompleteUpdate = !mUseDynamicScene;
   mUseDynamicScene = true;
 
-  if (sendCompleteUpdate) {
-    blackoutScene();
+  if (sendCompleteUpdate && (mFadeTime > 0)) {
+    startFade();
+  } else if (sendCompleteUpdate) {
+    sendChanges(mStaticScenes[mStaticSlot]);
+    sendChanges(mDynamicScene);
+  }
+}
+
+void Dmx::setRefreshBudget(const uint8_t budget) {
+  mRefreshBudget = budget;
+
+  if ((0 == mRefreshBudget) && mIsRefreshing) {
+    mIsRefreshing = false;
+    mIsRefreshRepeated = false;
+    mRefreshCursor = 0;
     sendScene();
   }
 }
+
+bool Dmx::isRefreshing() const { return mIsRefreshing; }
+
+uint8_t Dmx::refreshProgress() const {
+  return mIsRefreshing ? (uint8_t)(((uint32_t)mRefreshCursor * 100) / (kMaxDmxChannel + 1)) : 100;
+}
+
+void Dmx::refresh() {
+  bool isSweepDone = !mIsRefreshing;
+
+  for (uint8_t count = 0; !isSweepDone && (count < mRefreshBudget); count++) {
+    const uint16_t ch = mUseDynamicScene ? mDynamicScene.next(mRefreshCursor)
+                                         : mStaticScenes[mStaticSlot].next(mRefreshCursor);
+
+    if (ch <= kMaxDmxChannel) {
+      mRefreshCursor = ch + 1;
+      output(ch);
+    } else {
+      mRefreshCursor = 0;
+      mIsRefreshing = mIsRefreshRepeated;
+      mIsRefreshRepeated = false;
+      isSweepDone = true;  // every channel is output at most once per call
+    }
+  }
+}
+
+void Dmx::setFadeTime(const uint16_t fade_ms) { mFadeTime = fade_ms; }
+
+void Dmx::setFadeBudget(const uint8_t budget) { mFadeBudget = max_t(budget, (uint8_t)1); }
+
+bool Dmx::isFading() const { return mIsFading; }
+
+void Dmx::startFade() {
+  if (mIsFading && mIsFadeStarted) {
+    const uint32_t elapsed = min_t(mLastFade - mFadeStart, (uint32_t)mFadeTime);
+    mFadeStart = mLastFade - (mFadeTime - elapsed);  // reverse from the current mix
+    mFadeLevel = kFadeLevelMax - mFadeLevel;
+  } else {
+    mIsFadeStarted = false;
+    mFadeLevel = 0;
+  }
+
+  mIsFading = true;
+  mIsFinalSweep = false;
+  mFadeCursor = 0;
+}
+
+uint16_t Dmx::nextFadeChannel(const uint16_t channel) const {
+  return min_t(mStaticScenes[mStaticSlot].next(channel), mDynamicScene.next(channel));
+}
+
+void Dmx::fade(const uint32_t now_ms) {
+  if (mIsFading) {
+    if (!mIsFadeStarted) {
+      mIsFadeStarted = true;
+      mFadeStart = now_ms;
+    }
+
+    const uint32_t elapsed = now_ms - mFadeStart;
+    mLastFade = now_ms;
+    mFadeLevel = (elapsed >= mFadeTime) ? kFadeLevelMax : (uint16_t)((elapsed << 8) / mFadeTime);
+
+    bool isSweepDone = false;
+
+    for (uint8_t count = 0; !isSweepDone && (count < mFadeBudget); count++) {
+      if (0 == mFadeCursor) {
+        mIsFinalSweep = (kFadeLevelMax == mFadeLevel);
+      }
+
+      const uint16_t ch = nextFadeChannel(mFadeCursor);
+
+      if (ch <= kMaxDmxChannel) {
+        mFadeCursor = ch + 1;
+        output(ch);
+      } else {
+        mFadeCursor = 0;
+        mIsFading = !mIsFinalSweep;
+        isSweepDone = true;  // every channel is output at most once per call
+      }
+    }
+  }
+}
+
+bool Dmx::setSceneStore(ISceneStore* store) { return mSceneBank.setStore(store); }
+
+void Dmx::setSceneSaveDelay(const uint16_t delay_ms) { mSceneBank.setSaveDelay(delay_ms); }
+
+bool Dmx::restoreScenes() {
+  const bool returnValue = mSceneBank.restore();
+
+  if (returnValue) {
+#if MIDIDMXBRIDGE_USE_HIGH_RES
+    mDynamicScene.clearFine();  // the pairs are not part of the persisted image
+#endif
+    sendScene();
+  }
+
+  return returnValue;
+}
+
+void Dmx::persist(const uint32_t now_ms) { mSceneBank.persist(now_ms); }
+
+bool Dmx::isSceneSaved() const { return mSceneBank.isSaved(); }
+
+#if MIDIDMXBRIDGE_USE_FRAME_MODE
+void Dmx::setFrameMode(const bool enable) {
+  flush();
+  mUseFrameMode = enable;
+}
+
+bool Dmx::isFrameMode() const { return mUseFrameMode; }
+
+void Dmx::setFrameCallback(DmxOnFrameCallback callback) {
+  mFrameCallback = callback;
+
+  if (mFrameCallback) {
+    setFrameMode(true);
+  }
+}
+
+void Dmx::flush() {
+  const uint16_t first = mDirty.next(0);
+  uint16_t last = first;
+
+  for (uint16_t ch = first; ch < mDirty.size(); ch = mDirty.next(ch + 1)) {
+    updateFrame(ch, outputValue(ch));
+    last = ch;
+
+    if (mCallback && !mFrameCallback) {
+      mCallback(ch, mFrame[ch]);
+#if MIDIDMXBRIDGE_STATS
+      mCallbackCount++;
+#endif
+    }
+  }
+
+  if (mFrameCallback && (first < mDirty.size())) {
+    mFrameCallback(&mFrame[first], first, last - first + 1);
+#if MIDIDMXBRIDGE_STATS
+    mCallbackCount++;
+#endif
+  }
+
+  mDirty.clear();
+}
+#endif
+
+#if MIDIDMXBRIDGE_USE_SINKS
+bool Dmx::addSink(DmxOnFrameCallback callback, const uint16_t interval_ms) {
+  return mSinks.add(callback, interval_ms);
+}
+
+void Dmx::clearSinks() { mSinks.clear(); }
+
+void Dmx::serviceSinks(const uint32_t now_ms) {
+  if (mSinks.service(mFrame, now_ms)) {
+#if MIDIDMXBRIDGE_STATS
+    mCallbackCount++;
+#endif
+  }
+}
+#endif
+
+#if MIDIDMXBRIDGE_STATS
+uint32_t Dmx::callbackCount() const { return mCallbackCount; }
+
+void Dmx::resetStats() { mCallbackCount = 0; }
+#endif
 }  // namespace mididmxbridge::dmx
@@ -22,10 +22,20 @@
 #ifndef __MIDIDMXBRIDGE_DMX_H__
 #define __MIDIDMXBRIDGE_DMX_H__
 
+#include "Bitmap.h"
+#include "DenseScene.h"
 #include "DmxTypes.h"
 #include "DmxValue.h"
+#include "PatchMap.h"
+#include "SceneBank.h"
 #include "constants.h"
-#include "vector.h"
+#include "static_vector.h"
+#if MIDIDMXBRIDGE_USE_SINKS
+#include "DmxSinks.h"
+#endif
+#if MIDIDMXBRIDGE_USE_HIGH_RES
+#include "HighResDecoder.h"
+#endif
 
 namespace mididmxbridge::dmx {
 /**
@@ -33,6 +43,14 @@ namespace mididmxbridge::dmx {
  *
  */
 class Dmx {
+  using Scene = DenseScene<kMaxDmxChannel + 1>;         /**< channel-indexed DMX scene */
+  using Bank = SceneBank<Scene, kStaticSceneSlots + 1>; /**< static presets and dynamic scene */
+#if MIDIDMXBRIDGE_USE_HIGH_RES
+  using DynamicScene = PairedScene<kMaxDmxChannel + 1>; /**< scene with 16-bit value pairs */
+#else
+  using DynamicScene = Scene; /**< scene of 8-bit values only */
+#endif
+
  public:
   /**
    * @brief Construct a new Dmx object.
@@ -48,7 +66,14 @@ class Dmx {
    * @brief Destroy the Dmx object.
    *
    */
-  virtual ~Dmx() = default;
+  ~Dmx() = default;
+
+  /**
+   * @brief Returns the number of bytes the scenes occupy in the scene store.
+   *
+   * @return uint16_t - the size of the persisted scene bank
+   */
+  static constexpr uint16_t sceneStoreSize() { return Bank::size(); }
 
   /**
    * @brief Set the DMX gain.
@@ -58,10 +83,30 @@ class Dmx {
    *
    * The gain shall be in the range [0, ::kUnityGainValue] otherwise it is clipped.
    *
+   * The active scene is output with the new gain, either immediately or incrementally via refresh()
+   * if a refresh budget is set, see setRefreshBudget().
+   *
    * @param[in] gain the integer based gain value to apply
    */
   void setGain(const uint16_t gain);
 
+  /**
+   * @brief Set the response curve the DMX values are output with.
+   *
+   * The curve is applied in the output stage together with the gain, i.e. the stored scenes are not
+   * modified. The active scene is output with the new curve like after a gain change.
+   *
+   * @param[in] curve the response curve to apply
+   */
+  void setCurve(const DmxCurve curve);
+
+  /**
+   * @brief Get the response curve the DMX values are output with.
+   *
+   * @return DmxCurve - the active response curve
+   */
+  DmxCurve curve() const { return mCurve; }
+
   /**
    * @brief Set the DMX value pair based on a mididmxbridge::dmx::DmxValue.
    *
@@ -72,24 +117,147 @@ class Dmx {
   /**
    * @brief Set the DMX value pair based on MIDI CC values.
    *
+   * If no patch is defined, the MIDI CC controller plus the offset of the MIDI channel is used as
+   * DMX channel, see setChannelOffset(). Otherwise, the value is set on all DMX addresses the
+   * controller is patched to, see patch().
+   *
    * @param[in] midiCcController the input MIDI CC controller
    * @param[in] midiCcValue the input MIDI CC value
+   * @param[in] midiChannel the MIDI channel the value was received on, 0 if unknown
+   */
+  void setMidiCcValue(const uint8_t midiCcController, const uint8_t midiCcValue,
+                      const uint8_t midiChannel = 0);
+
+  /**
+   * @brief Patch a MIDI CC controller to a DMX address.
+   *
+   * As soon as a patch is defined, only patched MIDI CC controllers are output. The number of
+   * patches is limited to ::MIDIDMXBRIDGE_MAX_PATCHES.
+   *
+   * @see mididmxbridge::dmx::PatchMap::add
+   *
+   * @param[in] controller the MIDI CC controller in the range [0, mididmxbridge::kMaxMidiValue]
+   * @param[in] address the DMX address in the range [1, mididmxbridge::kMaxDmxChannel]
+   * @param[in] midiChannel the MIDI channel in the range [1, 16] or 0 for any MIDI channel
+   * @return true - the patch got added
+   * @return false - otherwise
+   */
+  bool patch(const uint8_t controller, const uint16_t address, const uint8_t midiChannel = 0);
+
+#if MIDIDMXBRIDGE_USE_HIGH_RES
+  /**
+   * @brief Set the resolution MIDI CC values are converted to DMX values with.
+   *
+   * With DmxResolution::k7Bit, the default, every MIDI CC controller is a separate 7-bit value.
+   * With the other resolutions, the MIDI CC controllers [0, 31] are combined with the controllers
+   * [32, 63] to 14-bit values and NRPN messages are decoded, see midi::HighResDecoder. The 14-bit
+   * values are then output on the DMX channel of the MSB controller, or on the DMX channel equal to
+   * the NRPN parameter plus the channel offset, see setChannelOffset(). With
+   * DmxResolution::k16Bit, the fine byte is output on the next DMX channel. The curve, the gain
+   * and the crossfade are then applied to the 16-bit value as a whole before it is split into the
+   * coarse and the fine byte, i.e. the output rises monotonically with the MIDI value.
+   *
+   * Only available if the library is compiled with ::MIDIDMXBRIDGE_USE_HIGH_RES set to 1.
+   *
+   * @param[in] resolution the resolution to use
+   */
+  void setResolution(const DmxResolution resolution);
+#endif
+
+  /**
+   * @brief Check whether messages of a MIDI CC controller may be coalesced before setMidiCcValue().
+   *
+   * With DmxResolution::k7Bit every MIDI CC controller is independent, i.e. only the last value of
+   * a controller matters. With the other resolutions, the controllers decoded statefully by
+   * midi::HighResDecoder must be passed in the order received. Without
+   * ::MIDIDMXBRIDGE_USE_HIGH_RES, every controller may be coalesced.
+   *
+   * @see midi::HighResDecoder::isStateful
+   *
+   * @param[in] controller the MIDI CC controller in the range [0, mididmxbridge::kMaxMidiValue]
+   * @return true - only the last value of the controller needs to be set
+   * @return false - every value of the controller needs to be set in order
+   */
+  bool isCoalescable(const uint8_t controller) const;
+
+  /**
+   * @brief Remove all patches, i.e. use the MIDI CC controller as DMX channel again.
+   *
    */
-  void setMidiCcValue(const uint8_t midiCcController, const uint8_t midiCcValue);
+  void clearPatches();
 
   /**
-   * @brief Setup the static RGB scene.
+   * @brief Set the DMX channel offset of a MIDI channel.
+   *
+   * As long as no patch is defined, MIDI CC values received on the MIDI channel are output on the
+   * DMX channel controller + \p offset, which e.g. gives each MIDI channel its own fixture group.
+   * The offset of all MIDI channels defaults to 0.
+   *
+   * @param[in] midiChannel the MIDI channel in the range [1, 16]
+   * @param[in] offset the DMX channel offset in the range [0, mididmxbridge::kMaxDmxChannel]
+   * @return true - the offset got set
+   * @return false - the parameters are out of range
+   */
+  bool setChannelOffset(const uint8_t midiChannel, const uint16_t offset);
+
+  /**
+   * @brief Setup the static RGB scene of the selected preset.
+   *
+   * The values are stored by DMX channel, i.e. assigning a channel again overwrites its value.
+   * Changes of the active scene are output by the next scene activation or refresh.
+   *
+   * @see selectStaticScene
    *
    * @param[in] channels the DMX channels associated with RGB
    * @param[in] rgb the RGB value to set
    */
   void setStaticScene(const DmxRgbChannels& channels, const DmxRgb& rgb);
 
+  /**
+   * @brief Setup the static RGB scene of a preset.
+   *
+   * @param[in] slot the preset in the range [0, mididmxbridge::kStaticSceneSlots - 1]
+   * @param[in] channels the DMX channels associated with RGB
+   * @param[in] rgb the RGB value to set
+   * @return true - the scene got set up
+   * @return false - the slot is out of range
+   */
+  bool setStaticScene(const uint8_t slot, const DmxRgbChannels& channels, const DmxRgb& rgb);
+
+  /**
+   * @brief Remove all channels from the static scene of a preset.
+   *
+   * @param[in] slot the preset in the range [0, mididmxbridge::kStaticSceneSlots - 1]
+   * @return true - the scene got cleared
+   * @return false - the slot is out of range
+   */
+  bool clearStaticScene(const uint8_t slot);
+
+  /**
+   * @brief Select the preset used as static scene.
+   *
+   * The preset defaults to 0. While the static scene is active or crossfaded, the channels of both
+   * the previous and the selected preset are output once, i.e. channels missing in the selected
+   * preset are turned off.
+   *
+   * @param[in] slot the preset in the range [0, mididmxbridge::kStaticSceneSlots - 1]
+   * @return true - the preset got selected
+   * @return false - the slot is out of range
+   */
+  bool selectStaticScene(const uint8_t slot);
+
+  /**
+   * @brief Get the preset used as static scene.
+   *
+   * @return uint8_t - the selected preset
+   */
+  uint8_t staticSceneSlot() const;
+
   /**
    * @brief Activate the static DMX scene.
    *
    * Only either the dynamic scene or the static scene can be active. The last request takes
-   * over the scene.
+   * over the scene. If a fade time is set, the scenes are crossfaded, see setFadeTime().
    *
    * @see activateDynamicScene
    *
@@ -97,23 +265,306 @@ class Dmx {
   void activateStaticScene();
 
   /**
-   * @brief Activate the dynamic DMX scene.77Only either the dynamic scene or the static scene can
-   * be active. The last request takes over the scene.
+   * @brief Activate the dynamic DMX scene.
+   *
+   * Only either the dynamic scene or the static scene can be active. The last request takes
+   * over the scene. If a fade time is set, the scenes are crossfaded, see setFadeTime().
    *
    * @see activateStaticScene
    *
    */
   void activateDynamicScene();
 
+  /**
+   * @brief Set the duration of the crossfade between the static and the dynamic scene.
+   *
+   * With a fade time of 0, the default, activateStaticScene() and activateDynamicScene() switch
+   * instantly by sending only the channels whose output changes. Otherwise, the channels of both
+   * scenes are interpolated over the fade time by fade(). Switching back during a crossfade
+   * reverses it from the current mix.
+   *
+   * @param[in] fade_ms the fade time in ms
+   */
+  void setFadeTime(const uint16_t fade_ms);
+
+  /**
+   * @brief Set the maximum number of DMX channels output per fade() call.
+   *
+   * A budget of 0 is clipped to 1. The default is mididmxbridge::kDefaultFadeBudget.
+   *
+   * @param[in] budget the maximum number of DMX channels to update per fade() call
+   */
+  void setFadeBudget(const uint8_t budget);
+
+  /**
+   * @brief Set the maximum number of DMX channels output per refresh() call.
+   *
+   * With a budget of 0, the default, a scene refresh caused by setGain() outputs all channels of
+   * the active scene immediately. Otherwise, the refresh is spread over several refresh() calls,
+   * which bounds the time spent per call. Setting a budget of 0 completes a pending refresh
+   * immediately.
+   *
+   * @param[in] budget the maximum number of DMX channels to output per refresh() call
+   */
+  void setRefreshBudget(const uint8_t budget);
+
+  /**
+   * @brief Advance a pending scene refresh.
+   *
+   * The next channels of the active scene are output, at most as many as set via
+   * setRefreshBudget(). If the gain changes while a refresh is running, the refresh is repeated
+   * once it is completed, i.e. every channel ends up with the latest gain.
+   *
+   */
+  void refresh();
+
+  /**
+   * @brief Checks if a scene refresh is pending.
+   *
+   * @return true if a scene refresh is pending
+   * @return false otherwise
+   */
+  bool isRefreshing() const;
+
+  /**
+   * @brief Get the progress of the pending scene refresh.
+   *
+   * @return uint8_t - the share of the DMX channels already refreshed in percent, 100 if no refresh
+   * is pending
+   */
+  uint8_t refreshProgress() const;
+
+  /**
+   * @brief Advance a running crossfade.
+   *
+   * The current mix of both scenes is computed from \p now_ms and output for the next channels of
+   * a round-robin sweep over all channels of both scenes, at most as many as set via
+   * setFadeBudget(). The crossfade ends after a complete sweep at the end of the fade time, i.e.
+   * all channels end up at the exact values of the new scene.
+   *
+   * The fade time starts with the first call after the scene got switched.
+   *
+   * @param[in] now_ms the current time in ms, see mididmxbridge::IClock
+   */
+  void fade(const uint32_t now_ms);
+
+  /**
+   * @brief Set the non-volatile memory to persist the static presets and the dynamic scene in.
+   *
+   * By default, the scenes are not persisted. A store too small for the scenes is rejected.
+   *
+   * @param[in] store the store, nullptr to disable persisting the scenes
+   * @return true - the store is used, or persisting got disabled via nullptr
+   * @return false - the store is too small, the scenes are not persisted
+   */
+  bool setSceneStore(ISceneStore* store);
+
+  /**
+   * @brief Set the time the scenes must be unchanged before they are saved by persist().
+   *
+   * The default is mididmxbridge::kDefaultSceneSaveDelayMs.
+   *
+   * @param[in] delay_ms the save delay in ms
+   */
+  void setSceneSaveDelay(const uint16_t delay_ms);
+
+  /**
+   * @brief Restore the static presets and the dynamic scene from the scene store and output the
+   * active scene.
+   *
+   * @return true - the scenes got restored
+   * @return false - there is no scene store or it holds no valid scene bank
+   */
+  bool restoreScenes();
+
+  /**
+   * @brief Advance the lazy save of the changed scenes to the scene store.
+   *
+   * @see mididmxbridge::dmx::SceneBank::persist
+   *
+   * @param[in] now_ms the current time in ms, see mididmxbridge::IClock
+   */
+  void persist(const uint32_t now_ms);
+
+  /**
+   * @brief Check whether all changes of the scenes have been saved to the scene store.
+   *
+   * @return true - no change is pending and no save is running
+   * @return false - otherwise
+   */
+  bool isSceneSaved() const;
+
+  /**
+   * @brief Checks if a crossfade is running.
+   *
+   * @return true if a crossfade is running
+   * @return false otherwise
+   */
+  bool isFading() const;
+
+#if MIDIDMXBRIDGE_USE_FRAME_MODE
+  /**
+   * @brief Enable or disable the frame-based output mode.
+   *
+   * In the default immediate mode, the DmxOnChangeCallback callback is triggered synchronously for
+   * every changed DMX channel. In the frame-based mode, changes are only flagged in a dirty bitmap
+   * and the callback is triggered once per changed channel with its latest value on flush().
+   * Several changes of the same channel between two flush() calls then result in a single callback.
+   *
+   * Pending changes are flushed when the frame-based mode gets disabled. The frame-based mode is
+   * only available if the library is compiled with ::MIDIDMXBRIDGE_USE_FRAME_MODE set to 1.
+   *
+   * @param[in] enable true to enable the frame-based mode, false to use the immediate mode
+   */
+  void setFrameMode(const bool enable);
+
+  /**
+   * @brief Check whether the frame-based output mode is enabled.
+   *
+   * @return true - the changes are output on flush()
+   * @return false - the changes are output immediately
+   */
+  bool isFrameMode() const;
+
+  /**
+   * @brief Register a callback receiving the changed DMX channels as one contiguous span.
+   *
+   * Registering a valid callback enables the frame-based mode, see setFrameMode(). On flush(), the
+   * callback is then triggered once with the span from the first to the last changed channel
+   * instead of triggering the DmxOnChangeCallback callback for every changed channel. The span also
+   * contains the current values of unchanged channels in between.
+   *
+   * @param[in] callback the callback to trigger once the DMX values change
+   */
+  void setFrameCallback(DmxOnFrameCallback callback);
+
+  /**
+   * @brief Trigger the DmxOnChangeCallback callback for all channels changed since the last call.
+   *
+   * If a DmxOnFrameCallback callback is registered, it is triggered instead with a single span
+   * covering all changed channels, see setFrameCallback().
+   *
+   * This function has no effect in the immediate mode, see setFrameMode().
+   *
+   */
+  void flush();
+#endif
+
+#if MIDIDMXBRIDGE_USE_SINKS
+
+  /**
+   * @brief Add a sink reading the DMX frame, e.g. to mirror the output to a second universe.
+   *
+   * In addition to the DmxOnChangeCallback and DmxOnFrameCallback callbacks, the sinks receive
+   * spans of the frame buffer holding the last DMX values output, see serviceSinks(). The frame is
+   * not copied, i.e. the sink shall not keep the pointer beyond the callback. The sinks are only
+   * available if the library is compiled with ::MIDIDMXBRIDGE_USE_SINKS set to 1.
+   *
+   * @see mididmxbridge::dmx::DmxSinks
+   *
+   * @param[in] callback the callback writing the span of DMX values to the sink
+   * @param[in] interval_ms the minimum interval between two writes in ms, 0 for every call
+   * @return true - the sink got added
+   * @return false - the callback is invalid or ::MIDIDMXBRIDGE_MAX_SINKS is exceeded
+   */
+  bool addSink(DmxOnFrameCallback callback, const uint16_t interval_ms);
+
+  /**
+   * @brief Remove all sinks added via addSink().
+   *
+   */
+  void clearSinks();
+
+  /**
+   * @brief Write the channels changed since its last write to the next due sink.
+   *
+   * In the frame-based mode, changes only reach the frame buffer on flush(), see setFrameMode().
+   *
+   * @param[in] now_ms the current time in ms
+   */
+  void serviceSinks(const uint32_t now_ms);
+#endif
+
+#if MIDIDMXBRIDGE_STATS
+  /**
+   * @brief Get the number of callbacks triggered since the last resetStats() call.
+   *
+   * Every DmxOnChangeCallback and DmxOnFrameCallback call and every sink write is counted once.
+   *
+   * @return uint32_t - the number of triggered callbacks
+   */
+  uint32_t callbackCount() const;
+
+  /**
+   * @brief Reset the statistics counters.
+   *
+   */
+  void resetStats();
+#endif
+
  private:
   /**
-   * @brief Apply the supplied gain value to the DMX value.
+   * @brief Set a 16-bit DMX value on all DMX addresses a MIDI CC controller is mapped to.
    *
-   * @param[in] value the DMX value to scale with the stored gain
+   * @param[in] controller the MIDI CC controller
+   * @param[in] midiChannel the MIDI channel the value was received on, 0 if unknown
+   * @param[in] value the 16-bit DMX value, the upper byte is the coarse value
+   * @param[in] withFine true to output the lower byte on the next DMX address
+   */
+  void setMappedValue(const uint8_t controller, const uint8_t midiChannel, const uint16_t value,
+                      const bool withFine);
+
+  /**
+   * @brief Set a 16-bit DMX value on a DMX address.
+   *
+   * @param[in] address the DMX address of the coarse value
+   * @param[in] value the 16-bit DMX value, the upper byte is the coarse value
+   * @param[in] withFine true to output the lower byte on the next DMX address
+   */
+  void setAddressValue(const uint16_t address, const uint16_t value, const bool withFine);
+
+  /**
+   * @brief Get the DMX channel offset of a MIDI channel.
+   *
+   * @param[in] midiChannel the MIDI channel, 0 if unknown
+   * @return uint16_t - the DMX channel offset, 0 for an unknown MIDI channel
+   */
+  uint16_t channelOffset(const uint8_t midiChannel) const;
+
+  /**
+   * @brief Apply the response curve and the supplied gain value to the DMX value.
+   *
+   * If ::MIDIDMXBRIDGE_USE_GAIN_LUT is enabled, even DMX values, i.e. all values converted from
+   * MIDI CC values, are scaled via a single table lookup. Odd values, which can only be set via the
+   * static scene or setDmxValue(), are still scaled arithmetically.
+   *
+   * @param[in] value the DMX value to scale with the stored curve and gain
    * @return uint8_t - the modified DMX value
    */
   uint8_t scaleValue(const uint8_t value) const;
 
+  /**
+   * @brief Rebuild the gain lookup table for the stored curve and gain.
+   *
+   * Entry [n] holds the scaled DMX value of the MIDI CC value n, i.e. of the DMX value 2 * n.
+   *
+   */
+  void updateGainLut();
+
+  /**
+   * @brief Store a scaled DMX value in the frame buffer and flag it for the sinks if it changed.
+   *
+   * @param[in] channel the DMX channel
+   * @param[in] value the scaled DMX value
+   */
+  void updateFrame(const uint16_t channel, const uint8_t value);
+
+  /**
+   * @brief Output the active scene after the gain or the curve changed.
+   *
+   */
+  void refreshScene();
+
   /**
    * @brief Update the current active DMX scene.
    *
@@ -127,27 +578,173 @@ class Dmx {
    * @brief Send the currently selected scene via the DmxOnChangeCallback callback.
    *
    */
-  void sendScene() const;
+  void sendScene();
+
+  /**
+   * @brief Send the channels of a scene whose scaled output differs from the value last sent.
+   *
+   * Calling it for both the scene left and the scene entered replaces a blackout followed by a
+   * complete update, i.e. only the channels actually changing are output.
+   *
+   * With ::MIDIDMXBRIDGE_USE_FRAME_KERNELS enabled, the scaled active frame is computed and diffed
+   * against the frame buffer as a whole, i.e. via the SIMD kernels of the host build.
+   *
+   * @param[in] scene the scene whose channels to check
+   */
+  void sendChanges(const Scene& scene);
+
+#if MIDIDMXBRIDGE_USE_FRAME_KERNELS
+  /**
+   * @brief Compute the scaled output of all channels of the active scene, including the crossfade.
+   *
+   * @param[out] frame the scaled DMX values, shall hold ::kMaxDmxChannel + 1 values
+   */
+  void scaleActiveFrame(uint8_t frame[]) const;
+#endif
+
+  /**
+   * @brief Output the active value of a channel, either immediately or by flagging it as dirty.
+   *
+   * @param[in] channel the DMX channel
+   */
+  void output(const uint16_t channel);
 
   /**
-   * @brief Blackout the currently **not** selected scene via the DmxOnChangeCallback callback.
+   * @brief Output the active value of a channel immediately via the DmxOnChangeCallback callback.
    *
+   * @param[in] channel the DMX channel
    */
-  void blackoutScene() const;
+  void sendValue(const uint16_t channel);
+
+  /**
+   * @brief Get the scaled output of a channel in the currently selected scene.
+   *
+   * The coarse and the fine channel of a 16-bit value are scaled as a whole, every other channel
+   * via scaleValue().
+   *
+   * @param[in] channel the DMX channel
+   * @return uint8_t - the scaled DMX value
+   */
+  uint8_t outputValue(const uint16_t channel) const;
+
+#if MIDIDMXBRIDGE_USE_HIGH_RES
+  /**
+   * @brief Get the unscaled 16-bit value of a coarse and fine channel pair in the selected scene.
+   *
+   * While a crossfade is running, the mix of both scenes at the current fade level is returned.
+   *
+   * @param[in] channel the coarse DMX channel
+   * @return uint16_t - the 16-bit DMX value
+   */
+  uint16_t activeValue16(const uint16_t channel) const;
+
+  /**
+   * @brief Check whether the 16-bit pairs of the dynamic scene apply to the output.
+   *
+   * The pairs belong to the dynamic scene, so a static scene outputs every channel on its own. A
+   * crossfade mixes the pairs as a whole until its final sweep, which outputs the target scene.
+   *
+   * @return true - the dynamic scene is active or still mixed into a crossfade
+   * @return false - otherwise
+   */
+  bool isPairOutput() const;
+
+  /**
+   * @brief Apply the response curve and the gain to a 16-bit DMX value.
+   *
+   * @param[in] value the 16-bit DMX value
+   * @return uint16_t - the scaled 16-bit DMX value
+   */
+  uint16_t scaleValue16(const uint16_t value) const;
+#endif
+
+  /**
+   * @brief Get the unscaled DMX value of a channel in the currently selected scene.
+   *
+   * While a crossfade is running, the mix of both scenes at the current fade level is returned.
+   *
+   * @param[in] channel the DMX channel
+   * @return uint8_t - the DMX value, 0 if the channel is not part of the selected scene
+   */
+  uint8_t activeValue(const uint16_t channel) const;
+
+  /**
+   * @brief Get the unscaled DMX value of a channel in the static scene.
+   *
+   * @param[in] channel the DMX channel
+   * @return uint8_t - the DMX value, 0 if the channel is not part of the static scene
+   */
+  uint8_t staticValue(const uint16_t channel) const;
+
+  /**
+   * @brief Start or reverse a crossfade after the scene got switched.
+   *
+   */
+  void startFade();
+
+  /**
+   * @brief Find the next channel of a crossfade sweep.
+   *
+   * @param[in] channel the DMX channel to start the search at
+   * @return uint16_t - the next channel of either scene, greater than kMaxDmxChannel if none
+   */
+  uint16_t nextFadeChannel(const uint16_t channel) const;
 
   /**
    * @brief Register the color value on the specified DMX channels.
    *
+   * @param[in,out] scene the static scene to assign the \p color in
    * @param[in] channels the DMX channels to assign the \p color to
    * @param[in] color the color value to assign
    */
-  void setRgbColor(const vector<uint8_t>& channels, const uint8_t color);
+  static void setRgbColor(Scene& scene, const DmxColorChannels& channels, const uint8_t color);
 
-  bool mUseDynamicScene;          /**< use the static scene if true, use dynamic otherwise */
-  vector<DmxValue> mStaticScene;  /**< the static scene description */
-  vector<DmxValue> mDynamicScene; /**< the dynamic scene description */
-  uint16_t mGain;                 /**< the current DMX gain factor */
-  DmxOnChangeCallback mCallback;  /**< the registered on-change callback */
+  bool mUseDynamicScene; /**< true: dynamic scene, false: static scene */
+#if MIDIDMXBRIDGE_USE_FRAME_MODE
+  bool mUseFrameMode; /**< flag changes in mDirty if true */
+#endif
+  Scene mStaticScenes[kStaticSceneSlots];       /**< the static scene presets */
+  uint8_t mStaticSlot;                          /**< the preset used as static scene */
+  DynamicScene mDynamicScene;                   /**< the dynamic scene description */
+  PatchMap mPatchMap;                           /**< the MIDI CC to DMX address patches */
+  uint16_t mChannelOffset[kMaxMidiChannel];     /**< the DMX channel offset per MIDI channel */
+#if MIDIDMXBRIDGE_USE_HIGH_RES
+  DmxResolution mResolution;     /**< the resolution of MIDI CC values */
+  midi::HighResDecoder mDecoder; /**< the decoder of 14-bit MIDI CC and NRPN */
+#endif
+#if MIDIDMXBRIDGE_USE_FRAME_MODE
+  Bitmap<kMaxDmxChannel + 1> mDirty; /**< the channels changed since the last flush() */
+#endif
+  uint8_t mFrame[kMaxDmxChannel + 1];           /**< the scaled DMX output last sent */
+  uint16_t mGain;                               /**< the current DMX gain factor */
+  DmxCurve mCurve;                              /**< the current DMX response curve */
+#if MIDIDMXBRIDGE_USE_GAIN_LUT
+  uint8_t mGainLut[kMaxMidiValue + 1]; /**< the scaled DMX values of all MIDI CC values */
+#endif
+  bool mIsFading;                    /**< true while a crossfade is running */
+  bool mIsFadeStarted;               /**< true once the fade time runs */
+  bool mIsFinalSweep;                /**< true if the sweep outputs the final values */
+  uint16_t mFadeTime;                /**< the crossfade duration in ms */
+  uint16_t mFadeLevel;               /**< the share of the new scene in the range [0, 256] */
+  uint16_t mFadeCursor;              /**< the next channel of the crossfade sweep */
+  uint8_t mFadeBudget;               /**< the maximum number of channels per fade() */
+  uint32_t mFadeStart;               /**< the start time of the crossfade in ms */
+  uint32_t mLastFade;                /**< the time of the last fade() call in ms */
+  bool mIsRefreshing;                /**< true while a scene refresh is pending */
+  bool mIsRefreshRepeated;           /**< true to repeat the refresh after completion */
+  uint8_t mRefreshBudget;            /**< the maximum number of channels per refresh() */
+  uint16_t mRefreshCursor;           /**< the next channel of the scene refresh */
+  DmxOnChangeCallback mCallback;     /**< the registered on-change callback */
+#if MIDIDMXBRIDGE_USE_FRAME_MODE
+  DmxOnFrameCallback mFrameCallback; /**< the registered frame callback */
+#endif
+#if MIDIDMXBRIDGE_USE_SINKS
+  DmxSinks mSinks; /**< the sinks reading the frame buffer */
+#endif
+  Bank mSceneBank; /**< the persisted scenes */
+#if MIDIDMXBRIDGE_STATS
+  uint32_t mCallbackCount; /**< the number of triggered callbacks */
+#endif
 };
 }  // namespace mididmxbridge::dmx
 #endif
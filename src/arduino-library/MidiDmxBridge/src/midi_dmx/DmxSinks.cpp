@@ -0,0 +1,82 @@
+/**
+ * @file DmxSinks.cpp
+ * @author Christian Neukam
+ * @brief Implementation of the mididmxbridge::dmx::DmxSinks class
+ * @version 1.0
+ * @date 2024-03-16
+ *
+ * @copyright Copyright 2024 Christian Neukam. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "DmxSinks.h"
+
+namespace mididmxbridge::dmx {
+DmxSinks::DmxSinks() : mSinks(), mNext(0) {}
+
+bool DmxSinks::add(DmxOnFrameCallback callback, const uint16_t interval_ms) {
+  const bool returnValue = (callback && !mSinks.full()) ? true : false;
+
+  if (returnValue) {
+    Sink sink = {callback, interval_ms, 0, false, {}};
+
+    for (uint16_t ch = 0; ch < sink.dirty.size(); ch++) {
+      sink.dirty.set(ch);  // the first write outputs the whole frame
+    }
+    mSinks.push_back(sink);
+  }
+
+  return returnValue;
+}
+
+void DmxSinks::clear() {
+  mSinks.clear();
+  mNext = 0;
+}
+
+uint8_t DmxSinks::size() const { return mSinks.size(); }
+
+void DmxSinks::markChanged(const uint16_t channel) {
+  for (uint8_t idx = 0; idx < mSinks.size(); idx++) {
+    mSinks[idx].dirty.set(channel);
+  }
+}
+
+bool DmxSinks::service(const uint8_t* frame, const uint32_t now_ms) {
+  bool returnValue = false;
+
+  for (uint8_t checked = 0; !returnValue && (checked < mSinks.size()); checked++) {
+    const uint8_t idx = (uint8_t)((mNext + checked) % mSinks.size());
+    Sink& sink = mSinks[idx];
+    const bool isDue = !sink.isWritten || ((now_ms - sink.lastWrite) >= sink.interval);
+    const uint16_t first = isDue ? sink.dirty.next(0) : sink.dirty.size();
+
+    if (first < sink.dirty.size()) {
+      uint16_t last = first;
+
+      for (uint16_t ch = first; ch < sink.dirty.size(); ch = sink.dirty.next(ch + 1)) {
+        last = ch;
+      }
+
+      sink.dirty.clear();
+      sink.lastWrite = now_ms;
+      sink.isWritten = true;
+      sink.callback(&frame[first], first, last - first + 1);
+      mNext = (uint8_t)((idx + 1) % mSinks.size());
+      returnValue = true;
+    }
+  }
+
+  return returnValue;
+}
+}  // namespace mididmxbridge::dmx
@@ -0,0 +1,113 @@
+/**
+ * @file DmxSinks.h
+ * @author Christian Neukam
+ * @brief Definition of the mididmxbridge::dmx::DmxSinks class
+ * @version 1.0
+ * @date 2024-03-16
+ *
+ * @copyright Copyright 2024 Christian Neukam. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef __MIDIDMXBRIDGE_DMX_SINKS_H__
+#define __MIDIDMXBRIDGE_DMX_SINKS_H__
+
+#include <stdint.h>
+
+#include "Bitmap.h"
+#include "DmxTypes.h"
+#include "constants.h"
+#include "static_vector.h"
+
+namespace mididmxbridge::dmx {
+/**
+ * @brief This class fans the DMX frame out to several sinks, e.g. a second universe or a monitor.
+ *
+ * All sinks read the same frame buffer, i.e. the frame is never copied. Every sink tracks its own
+ * changed channels in a dirty bitmap and is written at its own rate. On each service() call, at
+ * most one due sink is written in round-robin order, which bounds the time spent per call and keeps
+ * a slow sink from delaying the others by more than one call. Each sink occupies about 25 bytes
+ * of SRAM with the default of 128 DMX channels, up to ::MIDIDMXBRIDGE_MAX_SINKS sinks can be added.
+ *
+ */
+class DmxSinks {
+ public:
+  /**
+   * @brief Construct a new DmxSinks object without any sink.
+   *
+   */
+  DmxSinks();
+
+  /**
+   * @brief Add a sink.
+   *
+   * The sink receives the whole frame on the first service() call, afterwards only the span from
+   * the first to the last channel changed since its previous write.
+   *
+   * @param[in] callback the callback writing the span of DMX values to the sink
+   * @param[in] interval_ms the minimum interval between two writes in ms, 0 for every call
+   * @return true - the sink got added
+   * @return false - the callback is invalid or ::MIDIDMXBRIDGE_MAX_SINKS is exceeded
+   */
+  bool add(DmxOnFrameCallback callback, const uint16_t interval_ms);
+
+  /**
+   * @brief Remove all sinks.
+   *
+   */
+  void clear();
+
+  /**
+   * @brief Returns the number of sinks.
+   *
+   * @return uint8_t - the number of sinks
+   */
+  uint8_t size() const;
+
+  /**
+   * @brief Flag a changed channel of the frame for all sinks.
+   *
+   * @param[in] channel the changed DMX channel
+   */
+  void markChanged(const uint16_t channel);
+
+  /**
+   * @brief Write the changed channels to the next due sink.
+   *
+   * A sink is due once its interval elapsed and at least one of its channels changed.
+   *
+   * @param[in] frame the frame buffer of ::MIDIDMXBRIDGE_MAX_DMX_CHANNEL + 1 values
+   * @param[in] now_ms the current time in ms
+   * @return true - a sink got written
+   * @return false - no sink is due
+   */
+  bool service(const uint8_t* frame, const uint32_t now_ms);
+
+ private:
+  /**
+   * @brief This struct describes a registered sink.
+   *
+   */
+  struct Sink {
+    DmxOnFrameCallback callback;      /**< the callback writing to the sink */
+    uint16_t interval;                /**< the minimum interval between two writes in ms */
+    uint32_t lastWrite;               /**< the time of the last write in ms */
+    bool isWritten;                   /**< true once the sink got written */
+    Bitmap<kMaxDmxChannel + 1> dirty; /**< the channels changed since the last write */
+  };
+
+  static_vector<Sink, kMaxSinks> mSinks; /**< the registered sinks */
+  uint8_t mNext;                         /**< the sink to check first on the next service() */
+};
+}  // namespace mididmxbridge::dmx
+#endif
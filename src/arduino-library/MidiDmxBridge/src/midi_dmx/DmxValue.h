@@ -41,16 +41,16 @@ class DmxValue {
   /**
    * @brief Construct a new DmxValue object.
    *
-   * @param[in] channel the DMX channel in the range [1, 255]
+   * @param[in] channel the DMX channel in the range [1, 512]
    * @param[in] value the DMX value in the range [1, 255]
    */
-  DmxValue(const uint8_t channel, const uint8_t value);
+  DmxValue(const uint16_t channel, const uint8_t value);
 
   /**
    * @brief Destroy the DmxValue object.
    *
    */
-  virtual ~DmxValue() = default;
+  ~DmxValue() = default;
 
   /**
    * @brief Assignment operator for a DmxValue object.
@@ -89,9 +89,9 @@ class DmxValue {
   /**
    * @brief Get the DMX channel.
    *
-   * @return uint8_t - the dmx channel
+   * @return uint16_t - the dmx channel
    */
-  uint8_t channel() const;
+  uint16_t channel() const;
 
   /**
    * @brief Get the DMX value.
@@ -101,9 +101,9 @@ class DmxValue {
   uint8_t value() const;
 
  private:
-  bool mIsSet;      /**< indicates if the DmxValue was actively set */
-  uint8_t mChannel; /**< the DMX channel */
-  uint8_t mValue;   /**< the DMX value */
+  bool mIsSet;       /**< indicates if the DmxValue was actively set */
+  uint16_t mChannel; /**< the DMX channel */
+  uint8_t mValue;    /**< the DMX value */
 };
 }  // namespace mididmxbridge::dmx
 #endif
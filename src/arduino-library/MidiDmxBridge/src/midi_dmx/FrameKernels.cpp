@@ -0,0 +1,122 @@
+/**
+ * @file FrameKernels.cpp
+ * @author Christian Neukam
+ * @brief Implementation of the DMX frame kernels
+ * @version 1.0
+ * @date 2024-03-18
+ *
+ * @copyright Copyright 2024 Christian Neukam. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "FrameKernels.h"
+
+#if MIDIDMXBRIDGE_FRAME_KERNELS_SSE2
+#include <emmintrin.h>
+#elif MIDIDMXBRIDGE_FRAME_KERNELS_NEON
+#include <arm_neon.h>
+#endif
+
+#include "constants.h"
+
+namespace mididmxbridge::dmx {
+const uint8_t kLanes = 16; /**< DMX channels processed per SIMD step */
+
+void scaleFrame(const uint8_t src[], uint8_t dst[], const uint16_t count, const uint16_t gain) {
+  const uint16_t factor = (gain < kUnityGainValue) ? gain : kUnityGainValue;
+  uint16_t idx = 0;
+
+#if MIDIDMXBRIDGE_FRAME_KERNELS_SSE2
+  if (kUnityGainValue == factor) {
+    for (; (idx + kLanes) <= count; idx += kLanes) {
+      const __m128i values = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&src[idx]));
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(&dst[idx]), values);
+    }
+  } else {
+    // (v * gain) >> 10 equals (v * (gain << 6)) >> 16, i.e. the high half of a 16 bit product
+    const __m128i scale = _mm_set1_epi16((int16_t)(factor << (16 - kAnalogReadBits)));
+    const __m128i zero = _mm_setzero_si128();
+
+    for (; (idx + kLanes) <= count; idx += kLanes) {
+      const __m128i values = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&src[idx]));
+      const __m128i low = _mm_mulhi_epu16(_mm_unpacklo_epi8(values, zero), scale);
+      const __m128i high = _mm_mulhi_epu16(_mm_unpackhi_epi8(values, zero), scale);
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(&dst[idx]), _mm_packus_epi16(low, high));
+    }
+  }
+#elif MIDIDMXBRIDGE_FRAME_KERNELS_NEON
+  for (; (idx + kLanes) <= count; idx += kLanes) {
+    const uint8x16_t values = vld1q_u8(&src[idx]);
+    const uint16x8_t low = vmovl_u8(vget_low_u8(values));
+    const uint16x8_t high = vmovl_u8(vget_high_u8(values));
+    const uint16x8_t lowScaled =
+        vcombine_u16(vshrn_n_u32(vmull_n_u16(vget_low_u16(low), factor), kAnalogReadBits),
+                     vshrn_n_u32(vmull_n_u16(vget_high_u16(low), factor), kAnalogReadBits));
+    const uint16x8_t highScaled =
+        vcombine_u16(vshrn_n_u32(vmull_n_u16(vget_low_u16(high), factor), kAnalogReadBits),
+                     vshrn_n_u32(vmull_n_u16(vget_high_u16(high), factor), kAnalogReadBits));
+    vst1q_u8(&dst[idx], vcombine_u8(vmovn_u16(lowScaled), vmovn_u16(highScaled)));
+  }
+#endif
+
+  for (; idx < count; idx++) {
+    dst[idx] = ((uint32_t)src[idx] * (uint32_t)factor) >> kAnalogReadBits;
+  }
+}
+
+bool diffFrame(const uint8_t lhs[], const uint8_t rhs[], const uint16_t count, uint8_t mask[]) {
+  uint8_t differs = 0;
+  uint16_t idx = 0;
+
+#if MIDIDMXBRIDGE_FRAME_KERNELS_SSE2
+  for (; (idx + kLanes) <= count; idx += kLanes) {
+    const __m128i left = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&lhs[idx]));
+    const __m128i right = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&rhs[idx]));
+    const uint16_t bits = (uint16_t)~_mm_movemask_epi8(_mm_cmpeq_epi8(left, right));
+
+    mask[idx >> 3] = (uint8_t)bits;
+    mask[(idx >> 3) + 1] = (uint8_t)(bits >> 8);
+    differs |= (0 != bits) ? 1 : 0;
+  }
+#elif MIDIDMXBRIDGE_FRAME_KERNELS_NEON
+  static const uint8_t kBitWeights[kLanes] = {1, 2, 4, 8, 16, 32, 64, 128,
+                                              1, 2, 4, 8, 16, 32, 64, 128};
+  const uint8x16_t weights = vld1q_u8(kBitWeights);
+
+  for (; (idx + kLanes) <= count; idx += kLanes) {
+    const uint8x16_t unequal = vmvnq_u8(vceqq_u8(vld1q_u8(&lhs[idx]), vld1q_u8(&rhs[idx])));
+    const uint8x16_t weighted = vandq_u8(unequal, weights);
+    // three pairwise additions sum the weights of lanes 0-7 into byte 0 and of 8-15 into byte 1
+    uint8x8_t bits = vpadd_u8(vget_low_u8(weighted), vget_high_u8(weighted));
+    bits = vpadd_u8(bits, bits);
+    bits = vpadd_u8(bits, bits);
+
+    mask[idx >> 3] = vget_lane_u8(bits, 0);
+    mask[(idx >> 3) + 1] = vget_lane_u8(bits, 1);
+    differs |= (0 != (vget_lane_u8(bits, 0) | vget_lane_u8(bits, 1))) ? 1 : 0;
+  }
+#endif
+
+  for (; idx < count; idx++) {
+    if (0 == (idx & 0x07)) {
+      mask[idx >> 3] = 0;
+    }
+    if (lhs[idx] != rhs[idx]) {
+      mask[idx >> 3] |= (uint8_t)(1 << (idx & 0x07));
+      differs = 1;
+    }
+  }
+
+  return (0 != differs) ? true : false;
+}
+}  // namespace mididmxbridge::dmx
@@ -0,0 +1,63 @@
+/**
+ * @file FrameKernels.h
+ * @author Christian Neukam
+ * @brief Definition of the DMX frame kernels
+ * @version 1.0
+ * @date 2024-03-18
+ *
+ * @copyright Copyright 2024 Christian Neukam. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef __MIDIDMXBRIDGE_FRAME_KERNELS_H__
+#define __MIDIDMXBRIDGE_FRAME_KERNELS_H__
+
+#include <stdint.h>
+
+#if !defined(ARDUINO) && defined(__SSE2__)
+#define MIDIDMXBRIDGE_FRAME_KERNELS_SSE2 1 /**< the kernels process 16 channels per SSE2 step */
+#elif !defined(ARDUINO) && defined(__ARM_NEON)
+#define MIDIDMXBRIDGE_FRAME_KERNELS_NEON 1 /**< the kernels process 16 channels per NEON step */
+#endif
+
+namespace mididmxbridge::dmx {
+/**
+ * @brief Scale a whole frame of DMX values linearly with the supplied gain.
+ *
+ * Computes dst[i] = (src[i] * gain) >> ::kAnalogReadBits, i.e. exactly like the per-channel
+ * scaling with the linear curve. The kernel is selected at compile time: SSE2 or NEON on the host
+ * build, a scalar loop otherwise or for the tail of the frame. The frames may be the same buffer.
+ *
+ * @param[in] src the DMX values to scale
+ * @param[out] dst the scaled DMX values
+ * @param[in] count the number of DMX values in both frames
+ * @param[in] gain the gain, clipped to ::kUnityGainValue
+ */
+void scaleFrame(const uint8_t src[], uint8_t dst[], const uint16_t count, const uint16_t gain);
+
+/**
+ * @brief Compare two frames of DMX values and flag the channels that differ.
+ *
+ * Bit i of the mask is set if lhs[i] != rhs[i]. The bits are packed LSB first like in
+ * mididmxbridge::Bitmap, bits beyond count in the last byte are cleared.
+ *
+ * @param[in] lhs the first frame
+ * @param[in] rhs the second frame
+ * @param[in] count the number of DMX values in both frames
+ * @param[out] mask the dirty mask, shall hold (count + 7) / 8 bytes
+ * @return true - at least one channel differs
+ * @return false - otherwise
+ */
+bool diffFrame(const uint8_t lhs[], const uint8_t rhs[], const uint16_t count, uint8_t mask[]);
+}  // namespace mididmxbridge::dmx
+#endif
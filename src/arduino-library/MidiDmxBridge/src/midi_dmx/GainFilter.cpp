@@ -0,0 +1,76 @@
+/**
+ * @file GainFilter.cpp
+ * @author Christian Neukam
+ * @brief Implementation of the mididmxbridge::dmx::GainFilter class
+ * @version 1.0
+ * @date 2024-03-15
+ *
+ * @copyright Copyright 2024 Christian Neukam. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "GainFilter.h"
+
+#include "util.h"
+
+namespace mididmxbridge::dmx {
+using namespace mididmxbridge::util;
+
+static const uint8_t kFractionBits = 4;   /**< the fractional bits of the smoothed input */
+static const uint8_t kSmoothingShift = 2; /**< the smoothing factor 1 / 2^n of the average */
+static const uint8_t kLevelShift = 3;     /**< the gain levels are 2^n input units apart */
+
+static const uint16_t kLevelSize = 1 << (kLevelShift + kFractionBits); /**< fixed-point level */
+static const uint16_t kHysteresis = (kLevelSize * 3) / 4;              /**< level change distance */
+static const uint8_t kMaxLevel = kUnityGainValue >> kLevelShift;       /**< level of unity gain */
+
+GainFilter::GainFilter()
+    : mInterval(kDefaultAttenuationIntervalMs),
+      mLastSample(0),
+      mFiltered((uint16_t)kUnityGainValue << kFractionBits),
+      mLevel(kMaxLevel),
+      mIsPrimed(false) {}
+
+void GainFilter::setInterval(const uint16_t interval_ms) { mInterval = interval_ms; }
+
+bool GainFilter::isDue(const uint32_t now_ms) const {
+  return (!mIsPrimed || ((now_ms - mLastSample) >= mInterval)) ? true : false;
+}
+
+bool GainFilter::update(const uint16_t sample, const uint32_t now_ms) {
+  bool returnValue = false;
+
+  if (isDue(now_ms)) {
+    const uint16_t target = min_t(sample, kUnityGainValue) << kFractionBits;
+
+    if (!mIsPrimed) {
+      mFiltered = target;  // start at the first sample instead of fading in from unity gain
+      mIsPrimed = true;
+    } else if (target > mFiltered) {
+      mFiltered += (target - mFiltered + (1 << kSmoothingShift) - 1) >> kSmoothingShift;
+    } else {
+      mFiltered -= (mFiltered - target + (1 << kSmoothingShift) - 1) >> kSmoothingShift;
+    }
+    mLastSample = now_ms;
+
+    if (absDiff_t(mFiltered, (uint16_t)(mLevel * kLevelSize)) > kHysteresis) {
+      mLevel = (uint8_t)((mFiltered + (kLevelSize >> 1)) / kLevelSize);
+      returnValue = true;
+    }
+  }
+
+  return returnValue;
+}
+
+uint16_t GainFilter::gain() const { return (uint16_t)mLevel << kLevelShift; }
+}  // namespace mididmxbridge::dmx
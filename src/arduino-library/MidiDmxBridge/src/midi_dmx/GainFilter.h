@@ -0,0 +1,90 @@
+/**
+ * @file GainFilter.h
+ * @author Christian Neukam
+ * @brief Definition of the mididmxbridge::dmx::GainFilter class
+ * @version 1.0
+ * @date 2024-03-15
+ *
+ * @copyright Copyright 2024 Christian Neukam. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef __MIDIDMXBRIDGE_GAIN_FILTER_H__
+#define __MIDIDMXBRIDGE_GAIN_FILTER_H__
+
+#include <stdint.h>
+
+#include "constants.h"
+
+namespace mididmxbridge::dmx {
+/**
+ * @brief This class conditions the analog attenuation input, e.g. of a potentiometer.
+ *
+ * The samples are decimated to one per interval and smoothed by a fixed-point exponential moving
+ * average. The smoothed value is quantised to 128 gain levels, i.e. the resolution of MIDI CC
+ * values, with a hysteresis of a quarter level around the current level. The gain therefore only
+ * changes if the knob is actually moved, not due to ADC noise.
+ *
+ */
+class GainFilter {
+ public:
+  /**
+   * @brief Construct a new GainFilter object with unity gain.
+   *
+   */
+  GainFilter();
+
+  /**
+   * @brief Set the minimum interval between two samples.
+   *
+   * @param[in] interval_ms the interval in ms, 0 to use every sample
+   */
+  void setInterval(const uint16_t interval_ms);
+
+  /**
+   * @brief Check whether the next sample is due.
+   *
+   * @param[in] now_ms the current time in ms
+   * @return true - the next sample is processed by update()
+   * @return false - update() would discard the sample
+   */
+  bool isDue(const uint32_t now_ms) const;
+
+  /**
+   * @brief Process a sample of the attenuation input.
+   *
+   * Samples before the interval set via setInterval() elapsed are discarded.
+   *
+   * @param[in] sample the sample in the range [0, ::kUnityGainValue], otherwise it is clipped
+   * @param[in] now_ms the current time in ms
+   * @return true - the quantised gain changed, see gain()
+   * @return false - otherwise
+   */
+  bool update(const uint16_t sample, const uint32_t now_ms);
+
+  /**
+   * @brief Get the quantised gain.
+   *
+   * @return uint16_t - the gain in the range [0, ::kUnityGainValue]
+   */
+  uint16_t gain() const;
+
+ private:
+  uint16_t mInterval;   /**< the minimum interval between two samples in ms */
+  uint32_t mLastSample; /**< the time of the last processed sample in ms */
+  uint16_t mFiltered;   /**< the smoothed input in fixed-point format */
+  uint8_t mLevel;       /**< the current quantised gain level */
+  bool mIsPrimed;       /**< true once the first sample got processed */
+};
+}  // namespace mididmxbridge::dmx
+#endif
@@ -0,0 +1,117 @@
+/**
+ * @file HighResDecoder.cpp
+ * @author Christian Neukam
+ * @brief Implementation of the mididmxbridge::midi::HighResDecoder class
+ * @version 1.0
+ * @date 2024-03-02
+ *
+ * @copyright Copyright 2024 Christian Neukam. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "HighResDecoder.h"
+
+namespace mididmxbridge::midi {
+static const uint8_t kNone = 0xff;           /**< marks an unset state byte */
+static const uint8_t kLsbOffset = 32;        /**< the offset of the LSB controller to its MSB */
+static const uint8_t kMaxMsbController = 31; /**< the last MSB controller of a 14-bit pair */
+static const uint8_t kMaxLsbController = 63; /**< the last LSB controller of a 14-bit pair */
+static const uint8_t kDataEntryMsb = 6;      /**< the data entry MSB controller */
+static const uint8_t kDataEntryLsb = 38;     /**< the data entry LSB controller */
+static const uint8_t kNrpnLsb = 98;          /**< the NRPN parameter LSB controller */
+static const uint8_t kNrpnMsb = 99;          /**< the NRPN parameter MSB controller */
+static const uint8_t kRpnLsb = 100;          /**< the RPN parameter LSB controller */
+static const uint8_t kRpnMsb = 101;          /**< the RPN parameter MSB controller */
+static const uint8_t kNullParameter = 127;   /**< the MSB and LSB of the null parameter */
+
+HighResDecoder::HighResDecoder() : mState() { reset(); }
+
+void HighResDecoder::reset() {
+  for (uint8_t idx = 0; idx < kMaxMidiChannel; idx++) {
+    mState[idx] = ChannelState{kNone, 0, kNone, kNone, false, 0};
+  }
+}
+
+HighResDecoder::Result HighResDecoder::decode(const uint8_t controller, const uint8_t value,
+                                              const uint8_t midiChannel, HighResValue& result) {
+  const bool isValidChannel = (midiChannel > 0) && (midiChannel <= kMaxMidiChannel);
+  ChannelState& state = mState[isValidChannel ? midiChannel - 1 : 0];
+  const bool isDataEntry = (kDataEntryMsb == controller) || (kDataEntryLsb == controller);
+  const bool isSelected = (kNone != state.paramMsb) || (kNone != state.paramLsb);
+  const bool isComplete = (kNone != state.paramMsb) && (kNone != state.paramLsb);
+  Result returnValue = Result::kConsumed;
+
+  if (isDataEntry && state.isRpn && isSelected) {
+    returnValue = Result::kConsumed;  // the data entry of an RPN is no DMX value
+  } else if (isDataEntry && !state.isRpn && isComplete) {
+    returnValue = decodeNrpnData(state, kDataEntryMsb == controller, value, result);
+  } else if (controller <= kMaxMsbController) {
+    state.msbController = controller;
+    state.msb = value;
+    result = HighResValue{controller, (uint16_t)(value << 7), false};
+    returnValue = Result::kValue;
+  } else if (controller <= kMaxLsbController) {
+    if ((controller - kLsbOffset) == state.msbController) {
+      const uint16_t combined = (uint16_t)((state.msb << 7) | value);
+      result = HighResValue{state.msbController, combined, false};
+      returnValue = Result::kValue;
+    }
+  } else if ((kNrpnMsb == controller) || (kRpnMsb == controller)) {
+    selectParameter(state, kRpnMsb == controller, true, value);
+  } else if ((kNrpnLsb == controller) || (kRpnLsb == controller)) {
+    selectParameter(state, kRpnLsb == controller, false, value);
+  } else {
+    returnValue = Result::kPassThrough;
+  }
+
+  return returnValue;
+}
+
+bool HighResDecoder::isStateful(const uint8_t controller) {
+  return (controller <= kMaxLsbController) || ((controller >= kNrpnLsb) && (controller <= kRpnMsb));
+}
+
+void HighResDecoder::selectParameter(ChannelState& state, const bool isRpn, const bool isMsb,
+                                     const uint8_t value) {
+  if (isRpn != state.isRpn) {
+    state.paramMsb = kNone;  // the other half belongs to a parameter of the other kind
+    state.paramLsb = kNone;
+    state.isRpn = isRpn;
+  }
+
+  if (isMsb) {
+    state.paramMsb = value;
+  } else {
+    state.paramLsb = value;
+  }
+
+  if ((kNullParameter == state.paramMsb) && (kNullParameter == state.paramLsb)) {
+    state.paramMsb = kNone;
+    state.paramLsb = kNone;
+    state.isRpn = false;
+  }
+}
+
+HighResDecoder::Result HighResDecoder::decodeNrpnData(ChannelState& state, const bool isMsb,
+                                                      const uint8_t value, HighResValue& result) {
+  const uint16_t parameter = (uint16_t)((state.paramMsb << 7) | state.paramLsb);
+
+  if (isMsb) {
+    state.dataMsb = value;
+  }
+
+  result = HighResValue{parameter, (uint16_t)((state.dataMsb << 7) | (isMsb ? 0 : value)), true};
+
+  return Result::kValue;
+}
+}  // namespace mididmxbridge::midi
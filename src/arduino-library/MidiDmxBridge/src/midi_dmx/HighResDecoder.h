@@ -0,0 +1,151 @@
+/**
+ * @file HighResDecoder.h
+ * @author Christian Neukam
+ * @brief Definition of the mididmxbridge::midi::HighResDecoder class
+ * @version 1.0
+ * @date 2024-03-02
+ *
+ * @copyright Copyright 2024 Christian Neukam. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef __MIDIDMXBRIDGE_HIGH_RES_DECODER_H__
+#define __MIDIDMXBRIDGE_HIGH_RES_DECODER_H__
+
+#include <stdint.h>
+
+#include "constants.h"
+
+namespace mididmxbridge::midi {
+
+/**
+ * @brief This struct defines a decoded high-resolution MIDI value.
+ *
+ */
+struct HighResValue {
+  uint16_t parameter; /**< the MSB controller in [0, 31] or the NRPN parameter in [0, 16383] */
+  uint16_t value;     /**< the 14-bit value in the range [0, 16383] */
+  bool isNrpn;        /**< true: \p parameter is an NRPN parameter, false: a MIDI CC controller */
+};
+
+/**
+ * @brief This class decodes 14-bit MIDI CC pairs and NRPN messages from a MIDI CC stream.
+ *
+ * The decoder follows the MIDI 1.0 specification:
+ *  - the MIDI CC controllers [0, 31] carry the MSB of a 14-bit value, the controllers [32, 63] the
+ *    LSB of the controller 32 below. Receiving an MSB resets the LSB to 0, an LSB refines the value
+ *    of the last MSB received on the same MIDI channel,
+ *  - the MIDI CC controllers 99 and 98 select the NRPN parameter MSB and LSB, the controllers 6
+ *    and 38 then carry the data entry MSB and LSB of the NRPN parameter,
+ *  - the MIDI CC controllers 101 and 100 select an RPN parameter instead. The data entry of an RPN
+ *    is dropped, i.e. it neither carries an NRPN value nor the 14-bit pair of the controller 6,
+ *  - selecting the null parameter 127/127 deselects the NRPN or RPN parameter, the controllers 6
+ *    and 38 then carry a 14-bit pair again.
+ *
+ * The state is kept per MIDI channel in 6 bytes, i.e. the LSB is only paired with the latest MSB
+ * of a MIDI channel, which is how the MIDI senders transmit 14-bit values.
+ *
+ */
+class HighResDecoder {
+ public:
+  /**
+   * @brief The result of decoding a MIDI CC message.
+   *
+   */
+  enum class Result : uint8_t {
+    kPassThrough, /**< the message is no part of a high-resolution value */
+    kConsumed,    /**< the message is part of a high-resolution value but completes none */
+    kValue,       /**< the message completed a high-resolution value */
+  };
+
+  /**
+   * @brief Construct a new HighResDecoder object.
+   *
+   */
+  HighResDecoder();
+
+  /**
+   * @brief Decode the next MIDI CC message.
+   *
+   * @param[in] controller the MIDI CC controller in the range [0, 127]
+   * @param[in] value the MIDI CC value in the range [0, 127]
+   * @param[in] midiChannel the MIDI channel in the range [1, 16], 0 if unknown
+   * @param[out] result the decoded value, only updated if Result::kValue is returned
+   * @return Result - the classification of the message
+   */
+  Result decode(const uint8_t controller, const uint8_t value, const uint8_t midiChannel,
+                HighResValue& result);
+
+  /**
+   * @brief Check whether the decoding of a MIDI CC controller depends on the preceding messages.
+   *
+   * The messages of such controllers, i.e. the 14-bit MSB/LSB pairs [0, 63] and the NRPN/RPN
+   * parameter selection [98, 101], must be decoded in the order received. All other controllers are
+   * passed through and are independent of each other.
+   *
+   * @param[in] controller the MIDI CC controller in the range [0, 127]
+   * @return true - the controller is decoded statefully
+   * @return false - the controller is passed through
+   */
+  static bool isStateful(const uint8_t controller);
+
+  /**
+   * @brief Discard the state of all MIDI channels.
+   *
+   */
+  void reset();
+
+ private:
+  /**
+   * @brief This struct defines the decoder state of a MIDI channel.
+   *
+   */
+  struct ChannelState {
+    uint8_t msbController; /**< the controller of the last MSB, kNone if there is none */
+    uint8_t msb;           /**< the last MSB */
+    uint8_t paramMsb;      /**< the MSB of the selected parameter, kNone if there is none */
+    uint8_t paramLsb;      /**< the LSB of the selected parameter, kNone if there is none */
+    bool isRpn;            /**< true: the selected parameter is an RPN, false: an NRPN */
+    uint8_t dataMsb;       /**< the last data entry MSB of the selected NRPN parameter */
+  };
+
+  /**
+   * @brief Select the MSB or LSB of an NRPN or RPN parameter.
+   *
+   * Selecting a parameter of the other kind discards the half selected before, selecting the null
+   * parameter deselects the parameter.
+   *
+   * @param[in,out] state the state of the MIDI channel
+   * @param[in] isRpn true for an RPN parameter, false for an NRPN parameter
+   * @param[in] isMsb true for the parameter MSB, false for the parameter LSB
+   * @param[in] value the MIDI CC value
+   */
+  static void selectParameter(ChannelState& state, const bool isRpn, const bool isMsb,
+                              const uint8_t value);
+
+  /**
+   * @brief Decode a data entry MSB or LSB of the selected NRPN parameter.
+   *
+   * @param[in,out] state the state of the MIDI channel
+   * @param[in] isMsb true for the data entry MSB, false for the data entry LSB
+   * @param[in] value the MIDI CC value
+   * @param[out] result the decoded value
+   * @return Result - the classification of the message
+   */
+  static Result decodeNrpnData(ChannelState& state, const bool isMsb, const uint8_t value,
+                               HighResValue& result);
+
+  ChannelState mState[kMaxMidiChannel]; /**< the decoder state per MIDI channel */
+};
+}  // namespace mididmxbridge::midi
+#endif
@@ -1,7 +1,7 @@
 /**
  * @file MidiDmxBridge.cpp
  * @author Christian Neukam
- * @brief Implementation of the MidiDmxBridge class.
+ * @brief Explicit instantiation of the MidiDmxBridge class.
  * @version 1.0
  * @date 2024-01-04
  *
@@ -21,29 +21,4 @@
  */
 #include "../MidiDmxBridge.h"
 
-MidiDmxBridge::MidiDmxBridge(const uint8_t channel, DmxOnChangeCallback callback,
-                             ISerialReader& serial)
-    : mSleep(serial), mDmx(callback), mReader(channel, serial) {}
-
-void MidiDmxBridge::begin() { mReader.begin(); }
-
-void MidiDmxBridge::setStaticScene(const DmxRgbChannels& channels, const DmxRgb& rgb) {
-  mDmx.setStaticScene(channels, rgb);
-}
-
-void MidiDmxBridge::setAttenuation(const uint16_t attenuation) { mDmx.setGain(attenuation); }
-
-void MidiDmxBridge::switchToDynamicScene() { mDmx.activateDynamicScene(); }
-
-void MidiDmxBridge::switchToStaticScene() { mDmx.activateStaticScene(); }
-
-void MidiDmxBridge::listen() {
-  uint8_t controller;
-  uint8_t value;
-
-  if (mReader.readCc(controller, value)) {
-    mDmx.setMidiCcValue(controller, value);
-  }
-
-  mSleep.sleep(3);  // short refresh to process the callback
-}
+template class BasicMidiDmxBridge<ISerialReader>;
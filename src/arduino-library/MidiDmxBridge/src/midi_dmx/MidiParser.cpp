@@ -0,0 +1,109 @@
+/**
+ * @file MidiParser.cpp
+ * @author Christian Neukam
+ * @brief Implementation of the mididmxbridge::midi::MidiParser class
+ * @version 1.0
+ * @date 2024-02-03
+ *
+ * @copyright Copyright 2024 Christian Neukam. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "MidiParser.h"
+
+namespace mididmxbridge::midi {
+
+/**
+ * @brief Get the number of data bytes of a MIDI channel voice message.
+ *
+ * @param[in] status the status byte of the MIDI channel voice message in the range [0x80, 0xef]
+ * @return uint8_t - the number of data bytes following the status byte
+ */
+static uint8_t dataLength(const uint8_t status) {
+  const uint8_t type = status & 0xf0;
+  return ((type == 0xc0) || (type == 0xd0)) ? 1 : 2;  // program change, channel pressure
+}
+
+MidiParser::MidiParser()
+    : mRunningStatus(0),
+      mDataCount(0),
+      mFirstData(0)
+#if MIDIDMXBRIDGE_STATS
+      ,
+      mDroppedBytes(0),
+      mResyncs(0)
+#endif
+{
+}
+
+bool MidiParser::parse(const uint8_t byte, MidiMessage& message) {
+  bool returnValue = false;
+
+  if (byte >= 0xf8) {
+    // system realtime: does neither affect the running status nor the current message
+  } else if (byte >= 0xf0) {
+    reset();  // system common and system exclusive clear the running status
+  } else if (byte & 0x80) {
+    abortMessage();
+    mRunningStatus = byte;
+  } else if (mRunningStatus) {
+    const uint8_t length = dataLength(mRunningStatus);
+
+    if (mDataCount == 0) {
+      mFirstData = byte;
+    }
+    mDataCount++;
+
+    if (mDataCount == length) {
+      mDataCount = 0;  // keep the running status for the next message
+
+      message.status = mRunningStatus;
+      message.data1 = mFirstData;
+      message.data2 = (length == 2) ? byte : 0;
+      returnValue = true;
+    }
+  } else {
+#if MIDIDMXBRIDGE_STATS
+    mDroppedBytes++;  // data byte without running status
+#endif
+  }
+
+  return returnValue;
+}
+
+void MidiParser::reset() {
+  abortMessage();
+  mRunningStatus = 0;
+}
+
+void MidiParser::abortMessage() {
+#if MIDIDMXBRIDGE_STATS
+  if (mDataCount > 0) {
+    mDroppedBytes += mDataCount;
+    mResyncs++;
+  }
+#endif
+  mDataCount = 0;
+}
+
+#if MIDIDMXBRIDGE_STATS
+uint32_t MidiParser::droppedBytes() const { return mDroppedBytes; }
+
+uint32_t MidiParser::resyncs() const { return mResyncs; }
+
+void MidiParser::resetStats() {
+  mDroppedBytes = 0;
+  mResyncs = 0;
+}
+#endif
+}  // namespace mididmxbridge::midi
@@ -0,0 +1,127 @@
+/**
+ * @file MidiParser.h
+ * @author Christian Neukam
+ * @brief Definition of the mididmxbridge::midi::MidiParser class
+ * @version 1.0
+ * @date 2024-02-03
+ *
+ * @copyright Copyright 2024 Christian Neukam. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef __MIDIDMXBRIDGE_MIDI_PARSER_H__
+#define __MIDIDMXBRIDGE_MIDI_PARSER_H__
+
+#include <stdint.h>
+
+#include "constants.h"
+
+namespace mididmxbridge::midi {
+
+/**
+ * @brief This struct defines a decoded MIDI channel voice message.
+ *
+ */
+struct MidiMessage {
+  uint8_t status; /**< the status byte, e.g. 0xb0 for a MIDI CC message on MIDI channel 1 */
+  uint8_t data1;  /**< the first data byte, e.g. the MIDI CC controller */
+  uint8_t data2;  /**< the second data byte, e.g. the MIDI CC value, 0 for 1-byte messages */
+};
+
+/**
+ * @brief This class defines a resumable parser for the MIDI byte stream.
+ *
+ * The parser is fed byte by byte and keeps the state of a partially received message between
+ * calls. A message may therefore be split across any number of reads from the serial interface
+ * without being lost; every byte is decoded exactly once.
+ *
+ * The parser follows the MIDI running status rules:
+ *  - channel voice status bytes [0x80, 0xef] set the running status,
+ *  - system common status bytes [0xf0, 0xf7] clear the running status,
+ *  - system realtime bytes [0xf8, 0xff] are ignored and can be received at any position, i.e.
+ *    also in between the data bytes of a message,
+ *  - data bytes [0x00, 0x7f] are assigned to the message given by the running status.
+ *
+ */
+class MidiParser {
+ public:
+  /**
+   * @brief Construct a new MidiParser object.
+   *
+   */
+  MidiParser();
+
+  /**
+   * @brief Destroy the MidiParser object.
+   *
+   */
+  ~MidiParser() = default;
+
+  /**
+   * @brief Feed the next byte of the MIDI byte stream into the parser.
+   *
+   * @param[in] byte the next byte of the MIDI byte stream
+   * @param[out] message the decoded MIDI message, only updated if `true` is returned
+   * @return true - the \p byte completed a MIDI channel voice message
+   * @return false - otherwise
+   */
+  bool parse(const uint8_t byte, MidiMessage& message);
+
+  /**
+   * @brief Discard the running status and any partially received message.
+   *
+   */
+  void reset();
+
+#if MIDIDMXBRIDGE_STATS
+  /**
+   * @brief Get the number of data bytes discarded since the last resetStats() call.
+   *
+   * Data bytes are discarded if no running status is active, e.g. within SysEx messages, or if a
+   * partially received message is aborted by a status byte.
+   *
+   * @return uint32_t - the number of discarded data bytes
+   */
+  uint32_t droppedBytes() const;
+
+  /**
+   * @brief Get the number of partially received messages aborted by a status byte.
+   *
+   * @return uint32_t - the number of resynchronizations since the last resetStats() call
+   */
+  uint32_t resyncs() const;
+
+  /**
+   * @brief Reset the statistics counters.
+   *
+   */
+  void resetStats();
+#endif
+
+ private:
+  /**
+   * @brief Discard the partially received message, if any.
+   *
+   */
+  void abortMessage();
+
+  uint8_t mRunningStatus; /**< the last channel voice status byte, 0 if none */
+  uint8_t mDataCount;     /**< the number of data bytes received for the current message */
+  uint8_t mFirstData;     /**< the first data byte of the current message */
+#if MIDIDMXBRIDGE_STATS
+  uint32_t mDroppedBytes; /**< the number of discarded data bytes */
+  uint32_t mResyncs;      /**< the number of aborted messages */
+#endif
+};
+}  // namespace mididmxbridge::midi
+#endif
@@ -1,7 +1,7 @@
 /**
  * @file MidiReader.h
  * @author Christian Neukam
- * @brief Definition of the mididmxbridge::midi::MidiReader class
+ * @brief Definition of the mididmxbridge::midi::BasicMidiReader class
  * @version 1.0
  * @date 2023-12-31
  *
@@ -24,6 +24,10 @@
 
 #include <stdint.h>
 
+#include "MidiParser.h"
+#include "constants.h"
+#include "util.h"
+
 namespace mididmxbridge {
 class ISerialReader; /**< forward declaration */
 }
@@ -32,11 +36,19 @@ namespace mididmxbridge::midi {
 /**
  * @brief This class defines the reading feature for MIDI data.
  *
+ * The serial interface is a template parameter, i.e. if \p Reader is a final implementation of
+ * mididmxbridge::ISerialReader, e.g. SerialReaderHardware, the serial data is fetched without
+ * virtual dispatch and the compiler may inline the whole decoding path.
+ *
+ * @see mididmxbridge::midi::MidiReader
+ *
+ * @tparam Reader the type of the serial interface, providing the mididmxbridge::ISerialReader API
  */
-class MidiReader {
+template <class Reader>
+class BasicMidiReader {
  public:
   /**
-   * @brief Construct a new MidiReader object.
+   * @brief Construct a new BasicMidiReader object.
    *
    * As MIDI channels are usually 1-indexed and therefore cover a value range of [1, 16] with a
    * 4-bit resolution, this nominal value is also used here. If this value range is exceeded, the
@@ -45,56 +57,176 @@ class MidiReader {
    * @param[in] channel the MIDI channel to listen to in the range [1, 16]
    * @param[in] serial the serial interface
    */
-  MidiReader(const uint8_t channel, ISerialReader& serial);
+  BasicMidiReader(const uint8_t channel, Reader& serial)
+      : mChannelMask((uint16_t)(1 << (0x0f & normalizeChannel(channel)))),
+        mSerial(serial),
+        mParser(),
+        mBuffer(),
+        mBufferSize(0),
+        mBufferPos(0) {}
+
+  /**
+   * @brief Initialize the BasicMidiReader object.
+   *
+   */
+  void begin() { mSerial.begin(); }
 
   /**
-   * @brief Destroy the MidiReader object.
+   * @brief Set the MIDI channels to listen to.
+   *
+   * Bit n of the mask enables the MIDI channel n + 1, e.g. 0x0001 listens to MIDI channel 1 only
+   * and 0xffff listens to all MIDI channels. The mask replaces the MIDI channel passed to the
+   * constructor.
    *
+   * @param[in] mask the MIDI channel mask
    */
-  virtual ~MidiReader() = default;
+  void setChannelMask(const uint16_t mask) { mChannelMask = mask; }
 
   /**
-   * @brief Initialize the MidiReader object.
+   * @brief Get the MIDI channels the reader listens to.
+   *
+   * @see setChannelMask
    *
+   * @return uint16_t - the MIDI channel mask
    */
-  void begin();
+  uint16_t channelMask() const { return mChannelMask; }
 
   /**
    * @brief Read the next MIDI Continuous Controller (CC) from the serial interface.
    *
+   * MIDI CC messages sent with running status, i.e. without repeating the status byte, are
+   * supported as well as system realtime bytes interleaved with the message. A message that is only
+   * partially available on the serial interface is completed by one of the next calls.
+   *
    * @param[out] controller the MIDI CC controller, i.e. the second MIDI byte
    * @param[out] value the MIDI CC controller value, i.e. the third MIDI byte
    * @return true - the \p controller and \p value got updated
    * @return false - otherwise
    */
-  bool readCc(uint8_t& controller, uint8_t& value);
+  bool readCc(uint8_t& controller, uint8_t& value) {
+    uint8_t channel;
+    return readCc(controller, value, channel);
+  }
+
+  /**
+   * @brief Read the next MIDI Continuous Controller (CC) from the serial interface.
+   *
+   * In addition to readCc(uint8_t&, uint8_t&), the MIDI channel the message was received on is
+   * returned, which allows one reader to serve several MIDI channels, see setChannelMask().
+   *
+   * @param[out] controller the MIDI CC controller, i.e. the second MIDI byte
+   * @param[out] value the MIDI CC controller value, i.e. the third MIDI byte
+   * @param[out] channel the MIDI channel in the range [1, 16]
+   * @return true - the \p controller, \p value and \p channel got updated
+   * @return false - otherwise
+   */
+  bool readCc(uint8_t& controller, uint8_t& value, uint8_t& channel) {
+    bool returnValue = false;
+    MidiMessage message = {0, 0, 0};
+
+    while (!returnValue && fillBuffer()) {
+      if (mParser.parse(mBuffer[mBufferPos++], message)) {
+        returnValue = isListenedCc(message.status);
+      }
+    }
+
+    if (returnValue) {
+      controller = message.data1;
+      value = message.data2;
+      channel = (message.status & 0x0f) + 1;
+    }
+
+    return returnValue;
+  }
+
+  /**
+   * @brief Check whether the serial interface still holds unprocessed data.
+   *
+   * @return true - there are bytes left in the serial input buffer
+   * @return false - otherwise
+   */
+  bool hasPendingData() { return (mBufferPos < mBufferSize) || (mSerial.available() > 0); }
+
+#if MIDIDMXBRIDGE_STATS
+  /**
+   * @brief Get the MIDI parser, e.g. to query its statistics.
+   *
+   * @see mididmxbridge::midi::MidiParser::droppedBytes
+   *
+   * @return const MidiParser& - the parser of the MIDI byte stream
+   */
+  const MidiParser& parser() const { return mParser; }
+
+  /**
+   * @brief Reset the statistics counters of the MIDI parser.
+   *
+   */
+  void resetStats() { mParser.resetStats(); }
+#endif
 
  private:
   /**
-   * @brief Search the MIDI Continuous Controller (CC) sync byte.
+   * @brief Normalize the input MIDI channel.
+   *
+   * MIDI nominally uses channels in the range [1, 16]. However, 4-bit values in the range [0, 15]
+   * are transmitted at protocol level. With this function, the input values are normalized and
+   * clipped to the value range of the protocol level.
+   *
+   * @param[in] channel the MIDI channel
+   * @return uint8_t - the normalized MIDI channel in the range [0, 15]
+   */
+  static uint8_t normalizeChannel(const uint8_t channel) {
+    const uint8_t minMidiChannel = 1;
+    const uint8_t maxMidiChannel = 16;
+    return util::max_t(minMidiChannel, util::min_t(maxMidiChannel, channel)) - minMidiChannel;
+  }
+
+  /**
+   * @brief Ensure that the local buffer holds unprocessed bytes.
    *
-   * The sync byte is the or-link between the MIDI CC signature 0xB0 and the MIDI channel 0x0*, e.g.
-   * 0xB5 by using channel 5.
+   * If all bytes of the local buffer have been processed, the next burst of data is fetched from
+   * the serial interface with a single mididmxbridge::ISerialReader::readBytes() call.
    *
-   * @return true - the sync byte was found
+   * @return true - the local buffer holds at least one unprocessed byte
    * @return false - otherwise
    */
-  bool syncCc();
+  bool fillBuffer() {
+    if (mBufferPos >= mBufferSize) {
+      mBufferSize = (uint8_t)mSerial.readBytes(mBuffer, kSerialChunkSize);
+      mBufferPos = 0;
+    }
+
+    return mBufferPos < mBufferSize;
+  }
 
   /**
-   * @brief Read the next MIDI byte.
+   * @brief Check whether a status byte is a MIDI CC status on one of the enabled MIDI channels.
    *
-   * The next byte is transferred if it is in the permitted range [0x00, 0x7f]. Otherwise, the
-   * parameter \p data is not modified and `false` is returned.
+   * The channel mask serves as a 16 entry lookup table indexed by the channel nibble, i.e. the
+   * classification takes constant time regardless of the number of enabled MIDI channels.
    *
-   * @param[out] date the next MIDI byte if it is in the range [0x00, 0x7f]
-   * @return true - the byte is in the allowed range
+   * @param[in] status the MIDI status byte
+   * @return true - the status byte is to be processed
    * @return false - otherwise
    */
-  bool readByte(uint8_t& date);
+  bool isListenedCc(const uint8_t status) const {
+    return ((status & 0xf0) == 0xb0) && ((mChannelMask >> (status & 0x0f)) & 0x01);
+  }
 
-  const uint8_t mMidiCcSyncFilter; /**< the MIDI CC sync byte to listen to */
-  ISerialReader& mSerial;          /**< the serial interface */
+  uint16_t mChannelMask;             /**< bit n enables the MIDI CC status 0xb0 | n */
+  Reader& mSerial;                   /**< the serial interface */
+  MidiParser mParser;                /**< the parser of the MIDI byte stream */
+  uint8_t mBuffer[kSerialChunkSize]; /**< the local buffer of the serial data */
+  uint8_t mBufferSize;               /**< the number of valid bytes in the local buffer */
+  uint8_t mBufferPos;                /**< the position of the next unprocessed byte */
 };
+
+/**
+ * @brief Definition of the MIDI reader using the abstract mididmxbridge::ISerialReader interface.
+ *
+ */
+using MidiReader = BasicMidiReader<ISerialReader>;
+
+extern template class BasicMidiReader<ISerialReader>;
 }  // namespace mididmxbridge::midi
 #endif
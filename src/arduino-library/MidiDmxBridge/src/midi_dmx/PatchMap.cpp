@@ -0,0 +1,70 @@
+/**
+ * @file PatchMap.cpp
+ * @author Christian Neukam
+ * @brief Implementation of the mididmxbridge::dmx::PatchMap class
+ * @version 1.0
+ * @date 2024-02-27
+ *
+ * @copyright Copyright 2024 Christian Neukam. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "PatchMap.h"
+
+namespace mididmxbridge::dmx {
+PatchMap::PatchMap() : mPatches() {}
+
+bool PatchMap::add(const uint8_t controller, const uint16_t address, const uint8_t midiChannel) {
+  bool returnValue = (controller <= kMaxMidiValue) && (address > 0) &&
+                     (address <= kMaxDmxChannel) && (midiChannel <= kMaxMidiChannel);
+  bool isPatched = false;
+
+  for (uint8_t idx = 0; returnValue && !isPatched && (idx < mPatches.size()); idx++) {
+    const auto& patch = mPatches[idx];
+    isPatched = (patch.controller == controller) && (patch.midiChannel == midiChannel) &&
+                (patch.address == address);
+  }
+
+  if (returnValue && !isPatched) {
+    returnValue = !mPatches.full();
+    mPatches.push_back(Patch{controller, midiChannel, address});
+  }
+
+  return returnValue;
+}
+
+void PatchMap::clear() { mPatches.clear(); }
+
+bool PatchMap::empty() const { return mPatches.empty(); }
+
+uint8_t PatchMap::size() const { return mPatches.size(); }
+
+uint8_t PatchMap::find(const uint8_t controller, const uint8_t midiChannel,
+                       const uint8_t pos) const {
+  uint8_t idx = pos;
+
+  for (; idx < mPatches.size(); idx++) {
+    const auto& patch = mPatches[idx];
+    const bool channelMatches =
+        (0 == patch.midiChannel) || (0 == midiChannel) || (patch.midiChannel == midiChannel);
+
+    if ((patch.controller == controller) && channelMatches) {
+      break;
+    }
+  }
+
+  return idx;
+}
+
+uint16_t PatchMap::address(const uint8_t pos) const { return mPatches[pos].address; }
+}  // namespace mididmxbridge::dmx
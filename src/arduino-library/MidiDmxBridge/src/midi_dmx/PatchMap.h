@@ -0,0 +1,116 @@
+/**
+ * @file PatchMap.h
+ * @author Christian Neukam
+ * @brief Definition of the mididmxbridge::dmx::PatchMap class
+ * @version 1.0
+ * @date 2024-02-27
+ *
+ * @copyright Copyright 2024 Christian Neukam. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef __MIDIDMXBRIDGE_PATCH_MAP_H__
+#define __MIDIDMXBRIDGE_PATCH_MAP_H__
+
+#include <stdint.h>
+
+#include "constants.h"
+#include "static_vector.h"
+
+namespace mididmxbridge::dmx {
+/**
+ * @brief This class maps MIDI CC controllers to DMX addresses.
+ *
+ * Only the patched controllers are stored, i.e. the map occupies 4 bytes per patch instead of one
+ * entry per DMX address of the universe. A controller may be patched to several DMX addresses and
+ * several controllers may be patched to the same DMX address.
+ *
+ */
+class PatchMap {
+ public:
+  /**
+   * @brief Construct a new, empty PatchMap object.
+   *
+   */
+  PatchMap();
+
+  /**
+   * @brief Patch a MIDI CC controller to a DMX address.
+   *
+   * @param[in] controller the MIDI CC controller in the range [0, mididmxbridge::kMaxMidiValue]
+   * @param[in] address the DMX address in the range [1, mididmxbridge::kMaxDmxChannel]
+   * @param[in] midiChannel the MIDI channel in the range [1, 16] or 0 for any MIDI channel
+   * @return true - the patch got added or already existed
+   * @return false - the parameters are out of range or the map is full
+   */
+  bool add(const uint8_t controller, const uint16_t address, const uint8_t midiChannel);
+
+  /**
+   * @brief Remove all patches.
+   *
+   */
+  void clear();
+
+  /**
+   * @brief Checks if no patch is defined.
+   *
+   * @return true if the map is empty
+   * @return false otherwise
+   */
+  bool empty() const;
+
+  /**
+   * @brief Returns the number of patches.
+   *
+   * @return uint8_t - the number of patches
+   */
+  uint8_t size() const;
+
+  /**
+   * @brief Find the next patch of a MIDI CC controller.
+   *
+   * A patch matches if both the controller is equal and either the MIDI channels are equal or one
+   * of them is 0.
+   *
+   * @param[in] controller the MIDI CC controller
+   * @param[in] midiChannel the MIDI channel in the range [1, 16] or 0 for any MIDI channel
+   * @param[in] pos the index to start the search at
+   * @return uint8_t - the index of the next matching patch, size() if there is none
+   */
+  uint8_t find(const uint8_t controller, const uint8_t midiChannel, const uint8_t pos) const;
+
+  /**
+   * @brief Get the DMX address of a patch.
+   *
+   * @warning No bounds checking is performed.
+   *
+   * @param[in] pos the index of the patch as returned by find()
+   * @return uint16_t - the DMX address
+   */
+  uint16_t address(const uint8_t pos) const;
+
+ private:
+  /**
+   * @brief This struct defines a single patch.
+   *
+   */
+  struct Patch {
+    uint8_t controller;  /**< the MIDI CC controller */
+    uint8_t midiChannel; /**< the MIDI channel, 0 for any MIDI channel */
+    uint16_t address;    /**< the DMX address */
+  };
+
+  static_vector<Patch, kMaxPatches> mPatches; /**< the patches in the order of their creation */
+};
+}  // namespace mididmxbridge::dmx
+#endif
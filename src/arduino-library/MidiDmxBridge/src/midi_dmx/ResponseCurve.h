@@ -0,0 +1,236 @@
+/**
+ * @file ResponseCurve.h
+ * @author Christian Neukam
+ * @brief Compile-time generated response curves of the DMX output.
+ * @version 1.0
+ * @date 2024-03-13
+ *
+ * @copyright Copyright 2024 Christian Neukam. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef __MIDIDMXBRIDGE_RESPONSE_CURVE_H__
+#define __MIDIDMXBRIDGE_RESPONSE_CURVE_H__
+
+#include <stdint.h>
+
+#ifdef __AVR__
+#include <avr/pgmspace.h>
+#endif
+
+#include "DmxTypes.h"
+#include "util.h"
+
+namespace mididmxbridge::dmx {
+const uint8_t kCurveSize = 128;      /**< the number of entries of a response curve table */
+const uint8_t kMaxCurveValue = 254;  /**< the DMX value of the last entry, as for MIDI CC 127 */
+const uint8_t kFullScaleValue = 255; /**< the DMX value interpolated above the last entry */
+
+namespace detail {
+/**
+ * @brief Read an entry of a response curve table, which resides in program memory on AVR.
+ *
+ * @param[in] address the address of the entry
+ * @return uint8_t - the DMX value of the entry
+ */
+inline uint8_t readCurveByte(const uint8_t* address) {
+#ifdef __AVR__
+  return pgm_read_byte(address);
+#else
+  return *address;
+#endif
+}
+}  // namespace detail
+
+/**
+ * @brief This struct defines the linear response curve, i.e. the MIDI CC value times 2.
+ *
+ */
+struct LinearCurve {
+  /**
+   * @brief Compute an entry of the response curve.
+   *
+   * @param[in] idx the index in the range [0, kCurveSize - 1]
+   * @return uint8_t - the DMX value
+   */
+  static constexpr uint8_t value(const uint8_t idx) { return (uint8_t)(idx << 1); }
+};
+
+/**
+ * @brief This struct defines a gamma response curve.
+ *
+ * @tparam Gamma10 the gamma times 10, e.g. 22 for a gamma of 2.2
+ */
+template <uint8_t Gamma10>
+struct GammaCurve {
+  /**
+   * @brief Compute an entry of the response curve.
+   *
+   * @param[in] idx the index in the range [0, kCurveSize - 1]
+   * @return uint8_t - the DMX value
+   */
+  static constexpr uint8_t value(const uint8_t idx) {
+    return (uint8_t)(kMaxCurveValue *
+                         util::pow_t(idx / (double)(kCurveSize - 1), Gamma10 / 10.0) +
+                     0.5);
+  }
+};
+
+/**
+ * @brief This struct defines the smoothstep response curve 3x^2 - 2x^3.
+ *
+ */
+struct SCurve {
+  /**
+   * @brief Compute an entry of the response curve.
+   *
+   * @param[in] idx the index in the range [0, kCurveSize - 1]
+   * @return uint8_t - the DMX value
+   */
+  static constexpr uint8_t value(const uint8_t idx) {
+    return (uint8_t)((kMaxCurveValue * idx * idx * (3 * (kCurveSize - 1) - 2 * idx)) /
+                         ((double)(kCurveSize - 1) * (kCurveSize - 1) * (kCurveSize - 1)) +
+                     0.5);
+  }
+};
+
+/**
+ * @brief This struct defines a compile-time sequence of table indices.
+ *
+ * @tparam Is the indices
+ */
+template <uint8_t... Is>
+struct CurveIndices {};
+
+/**
+ * @brief This struct generates the table indices [0, N - 1], as std::make_index_sequence is not
+ * available on all Arduino platforms.
+ *
+ * @tparam N the number of indices
+ * @tparam Is the indices generated so far
+ */
+template <uint8_t N, uint8_t... Is>
+struct MakeCurveIndices : MakeCurveIndices<N - 1, N - 1, Is...> {};
+
+/**
+ * @brief This struct terminates the generation of the table indices.
+ *
+ * @tparam Is the generated indices
+ */
+template <uint8_t... Is>
+struct MakeCurveIndices<0, Is...> {
+  using type = CurveIndices<Is...>; /**< the generated sequence */
+};
+
+/**
+ * @brief This struct holds the table of a response curve in program memory.
+ *
+ * The entries are evaluated by the compiler, i.e. neither CPU time nor SRAM is spent at runtime.
+ *
+ * @tparam Curve the response curve, e.g. GammaCurve
+ * @tparam Indices the table indices
+ */
+template <class Curve, class Indices = typename MakeCurveIndices<kCurveSize>::type>
+struct CurveTable;
+
+/**
+ * @brief This struct holds the table of a response curve in program memory.
+ *
+ * @tparam Curve the response curve, e.g. GammaCurve
+ * @tparam Is the table indices
+ */
+template <class Curve, uint8_t... Is>
+struct CurveTable<Curve, CurveIndices<Is...>> {
+  static const uint8_t kValues[sizeof...(Is)]; /**< the DMX values of the curve */
+};
+
+#ifdef __AVR__
+template <class Curve, uint8_t... Is>
+const uint8_t CurveTable<Curve, CurveIndices<Is...>>::kValues[sizeof...(Is)] PROGMEM = {
+    Curve::value(Is)...};
+#else
+template <class Curve, uint8_t... Is>
+const uint8_t CurveTable<Curve, CurveIndices<Is...>>::kValues[sizeof...(Is)] = {
+    Curve::value(Is)...};
+#endif
+
+/**
+ * @brief Apply a response curve to a DMX value.
+ *
+ * Even DMX values, i.e. all values generated from 7-bit MIDI CC values, are looked up directly.
+ * Odd DMX values are interpolated between the two neighboring entries, the value 255 between the
+ * last entry and kFullScaleValue, i.e. every curve maps 255 to 255.
+ *
+ * @param[in] curve the response curve
+ * @param[in] value the DMX value
+ * @return uint8_t - the DMX value after applying the response curve
+ */
+inline uint8_t applyCurve(const DmxCurve curve, const uint8_t value) {
+  const uint8_t* table = nullptr;
+  uint8_t returnValue = value;
+
+  if (DmxCurve::kGamma == curve) {
+    table = CurveTable<GammaCurve<22>>::kValues;
+  } else if (DmxCurve::kSCurve == curve) {
+    table = CurveTable<SCurve>::kValues;
+  }
+
+  if (nullptr != table) {
+    const uint8_t idx = value >> 1;
+    returnValue = detail::readCurveByte(&table[idx]);
+
+    if (value & 0x01) {
+      const uint8_t next =
+          (idx < kCurveSize - 1) ? detail::readCurveByte(&table[idx + 1]) : kFullScaleValue;
+      returnValue = (uint8_t)((returnValue + next + 1) >> 1);
+    }
+  }
+
+  return returnValue;
+}
+
+/**
+ * @brief Apply a response curve to a 16-bit DMX value, i.e. a coarse and fine channel pair.
+ *
+ * The curve table is interpolated linearly over the whole 16-bit range and the result is stretched
+ * from the table range [0, kMaxCurveValue] to [0, 0xffff], i.e. the curve rises monotonically and
+ * maps 0xffff to 0xffff. The linear curve returns the value unchanged.
+ *
+ * @param[in] curve the response curve to apply
+ * @param[in] value the 16-bit DMX value
+ * @return uint16_t - the curved 16-bit DMX value
+ */
+inline uint16_t applyCurve16(const DmxCurve curve, const uint16_t value) {
+  const uint8_t* table = nullptr;
+  uint16_t returnValue = value;
+
+  if (DmxCurve::kGamma == curve) {
+    table = CurveTable<GammaCurve<22>>::kValues;
+  } else if (DmxCurve::kSCurve == curve) {
+    table = CurveTable<SCurve>::kValues;
+  }
+
+  if (nullptr != table) {
+    const uint32_t position = (uint32_t)value * (kCurveSize - 1);
+    const uint8_t idx = position / 0xffff;
+    const uint32_t fraction = position % 0xffff;
+    const uint8_t low = detail::readCurveByte(&table[idx]);
+    const uint8_t high = detail::readCurveByte(&table[(idx < kCurveSize - 1) ? idx + 1 : idx]);
+
+    returnValue = (uint16_t)(((uint32_t)low * 0xffff + (high - low) * fraction) / kMaxCurveValue);
+  }
+
+  return returnValue;
+}
+}  // namespace mididmxbridge::dmx
+#endif
@@ -0,0 +1,162 @@
+/**
+ * @file RingBuffer.h
+ * @author Christian Neukam
+ * @brief Definition of the mididmxbridge::RingBuffer class template.
+ * @version 1.0
+ * @date 2024-02-10
+ *
+ * @copyright Copyright 2024 Christian Neukam. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef __MIDIDMXBRIDGE_RING_BUFFER_H__
+#define __MIDIDMXBRIDGE_RING_BUFFER_H__
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace mididmxbridge {
+/**
+ * @brief This class provides a lock-free single-producer/single-consumer ring buffer.
+ *
+ * The buffer is designed to be filled from an interrupt service routine (the producer) while it is
+ * drained from the main loop (the consumer). The producer only modifies the write index, the
+ * consumer only modifies the read index. As both indices are single bytes, they are updated
+ * atomically on 8-bit MCUs without disabling interrupts.
+ *
+ * One element is kept free to distinguish a full from an empty buffer, i.e. the buffer holds up to
+ * N - 1 elements.
+ *
+ * @warning The buffer relies on the ordering of volatile accesses of a single core MCU. It is not
+ * meant to be shared between threads of a multi-core host.
+ *
+ * @tparam T the scalar type of the elements, e.g. uint8_t
+ * @tparam N the number of elements, must be a power of two in the range [2, 256]
+ */
+template <class T, uint16_t N>
+class RingBuffer {
+  static_assert((N >= 2) && (N <= 256), "N must be in the range [2, 256]");
+  static_assert((N & (N - 1)) == 0, "N must be a power of two");
+
+ public:
+  /**
+   * @brief Construct a new, empty RingBuffer object.
+   *
+   */
+  RingBuffer() : mHead(0), mTail(0), mDropped(0), mData() {}
+
+  /**
+   * @brief Append an element to the buffer (producer side).
+   *
+   * If the buffer is full, the element is discarded and the drop counter is incremented.
+   *
+   * @param[in] value the element to append
+   * @return true - the element got appended
+   * @return false - the buffer is full
+   */
+  bool push(const T value) {
+    bool returnValue = false;
+    const uint8_t head = mHead;
+    const uint8_t next = (head + 1) & kMask;
+
+    if (next != mTail) {
+      mData[head] = value;
+      mHead = next;  // publish the element only after it has been written
+      returnValue = true;
+    } else {
+      mDropped++;
+    }
+
+    return returnValue;
+  }
+
+  /**
+   * @brief Remove the oldest element from the buffer (consumer side).
+   *
+   * @param[out] value the removed element, only updated if `true` is returned
+   * @return true - an element got removed
+   * @return false - the buffer is empty
+   */
+  bool pop(T& value) {
+    bool returnValue = false;
+    const uint8_t tail = mTail;
+
+    if (tail != mHead) {
+      value = mData[tail];
+      mTail = (tail + 1) & kMask;  // release the slot only after it has been read
+      returnValue = true;
+    }
+
+    return returnValue;
+  }
+
+  /**
+   * @brief Remove up to \p max of the oldest elements from the buffer (consumer side).
+   *
+   * @param[out] dst the destination buffer, which must hold at least \p max elements
+   * @param[in] max the maximum number of elements to remove
+   * @return size_t - the number of elements transferred to \p dst
+   */
+  size_t pop(T* dst, const size_t max) {
+    const uint8_t head = mHead;  // take a snapshot, new elements are read with the next call
+    uint8_t tail = mTail;
+    size_t count = 0;
+
+    while ((count < max) && (tail != head)) {
+      dst[count++] = mData[tail];
+      tail = (tail + 1) & kMask;
+    }
+    mTail = tail;
+
+    return count;
+  }
+
+  /**
+   * @brief Returns the number of elements in the buffer.
+   *
+   * @return uint8_t - the number of elements in the buffer
+   */
+  uint8_t size() const { return (uint8_t)(mHead - mTail) & kMask; }
+
+  /**
+   * @brief Checks if the buffer has no elements.
+   *
+   * @return true if the buffer is empty
+   * @return false otherwise
+   */
+  bool empty() const { return mHead == mTail; }
+
+  /**
+   * @brief Returns the maximum number of elements the buffer is able to hold.
+   *
+   * @return uint8_t - the maximum number of elements
+   */
+  uint8_t capacity() const { return kMask; }
+
+  /**
+   * @brief Returns the number of elements discarded because the buffer was full.
+   *
+   * @return uint8_t - the number of discarded elements, wraps around at 256
+   */
+  uint8_t dropped() const { return mDropped; }
+
+ private:
+  static constexpr uint8_t kMask = (uint8_t)(N - 1); /**< the index mask */
+
+  volatile uint8_t mHead;    /**< the write index, modified by the producer only */
+  volatile uint8_t mTail;    /**< the read index, modified by the consumer only */
+  volatile uint8_t mDropped; /**< the number of discarded elements, modified by the producer */
+  volatile T mData[N];       /**< the raw data array */
+};
+}  // namespace mididmxbridge
+#endif
@@ -0,0 +1,287 @@
+/**
+ * @file SceneBank.h
+ * @author Christian Neukam
+ * @brief Definition of the mididmxbridge::dmx::SceneBank class template.
+ * @version 1.0
+ * @date 2024-03-12
+ *
+ * @copyright Copyright 2024 Christian Neukam. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef __MIDIDMXBRIDGE_SCENE_BANK_H__
+#define __MIDIDMXBRIDGE_SCENE_BANK_H__
+
+#include <stdint.h>
+
+#include "ISceneStore.h"
+#include "constants.h"
+
+namespace mididmxbridge::dmx {
+const uint16_t kSceneBankMagic = 0x4d44; /**< the magic number of the scene bank, "MD" */
+const uint8_t kSceneBankVersion = 2;     /**< the version of the binary scene bank format */
+const uint8_t kSceneBankHeaderSize = 7;  /**< magic, version, scene count, size and checksum */
+const uint8_t kSceneBankInvalid = 0xff;  /**< the first header byte while a save is running */
+const uint8_t kSceneBankCrcPoly = 0x07;  /**< the CRC-8 polynomial x^8 + x^2 + x + 1 */
+
+/**
+ * @brief This class persists the binary image of a fixed set of scenes in an ISceneStore.
+ *
+ * The scene bank consists of a header followed by the images of all scenes. The header holds
+ * the magic number, the format version, the number of scenes, the size of each scene image in
+ * bytes and a CRC-8 of all scene images, i.e. a scene bank written by another build, never written
+ * at all or corrupted by worn EEPROM cells is not restored.
+ *
+ * Changes are saved lazily via persist(): once the scenes have not changed for the save delay, the
+ * scene bank is compared to the store in steps of mididmxbridge::kSceneSaveBudget bytes and at most
+ * one changed byte is written per step. Changes during a save delay or a running save are
+ * coalesced into the next save, which keeps both the EEPROM wear and the execution time per call
+ * low. Before the first changed scene byte is written, the header is invalidated, and it is written
+ * back last. A reset during a save therefore restores no scenes rather than a torn mix of the old
+ * and the new scenes. A save that changes no scene byte leaves the header untouched.
+ *
+ * @tparam Scene the scene type, which must be trivially copyable, e.g. DenseScene
+ * @tparam N the number of scenes in the range [1, 255]
+ */
+template <class Scene, uint8_t N>
+class SceneBank {
+ public:
+  /**
+   * @brief Construct a new SceneBank object without store and scenes.
+   *
+   */
+  SceneBank()
+      : mStore(nullptr),
+        mScenes(),
+        mSaveDelay(kDefaultSceneSaveDelayMs),
+        mChangedAt(0),
+        mCursor(0),
+        mIsChanged(false),
+        mIsPending(false),
+        mIsSaving(false),
+        mIsInvalidated(false),
+        mCrc(0) {}
+
+  /**
+   * @brief Register a scene of the scene bank.
+   *
+   * Every scene must be registered before the scene bank is restored or saved.
+   *
+   * @param[in] idx the index of the scene in the range [0, N - 1]
+   * @param[in] scene the scene to persist
+   */
+  void attach(const uint8_t idx, Scene& scene) {
+    if (idx < N) {
+      mScenes[idx] = &scene;
+    }
+  }
+
+  /**
+   * @brief Set the non-volatile memory to persist the scenes in.
+   *
+   * A running save is aborted, pending changes are saved to the new store. A store smaller than
+   * size() is rejected, i.e. the scenes are not persisted, since its addresses would overflow.
+   *
+   * @param[in] store the store, nullptr to disable persisting the scenes
+   * @return true - the store is used, or persisting got disabled via nullptr
+   * @return false - the store is too small, persisting is disabled
+   */
+  bool setStore(ISceneStore* store) {
+    const bool returnValue = (nullptr == store) || (store->length() >= size());
+
+    mStore = returnValue ? store : nullptr;
+    mIsPending = mIsPending || mIsSaving;
+    mIsSaving = false;
+    mCursor = 0;
+
+    return returnValue;
+  }
+
+  /**
+   * @brief Set the time the scenes must be unchanged before they are saved.
+   *
+   * The default is mididmxbridge::kDefaultSceneSaveDelayMs.
+   *
+   * @param[in] delay_ms the save delay in ms
+   */
+  void setSaveDelay(const uint16_t delay_ms) { mSaveDelay = delay_ms; }
+
+  /**
+   * @brief Restore all scenes from the store with a single sequential read per scene.
+   *
+   * The checksum of the scene images is verified before any scene is overwritten.
+   *
+   * @return true - the scenes got restored
+   * @return false - there is no store or it holds no valid scene bank, the scenes are unchanged
+   */
+  bool restore() {
+    bool returnValue = (nullptr != mStore) && (mStore->length() >= size());
+
+    if (returnValue) {
+      uint8_t header[kSceneBankHeaderSize];
+      uint8_t crc = 0;
+
+      for (uint16_t address = kSceneBankHeaderSize; address < size(); address++) {
+        crc = crc8(crc, mStore->read(address));
+      }
+      mStore->readBytes(0, header, sizeof(header));
+
+      for (uint8_t idx = 0; idx < kSceneBankHeaderSize; idx++) {
+        returnValue = returnValue && (header[idx] == headerByte(idx, crc));
+      }
+    }
+
+    if (returnValue) {
+      for (uint8_t idx = 0; idx < N; idx++) {
+        mStore->readBytes(kSceneBankHeaderSize + idx * sizeof(Scene), (uint8_t*)mScenes[idx],
+                          sizeof(Scene));
+      }
+    }
+
+    return returnValue;
+  }
+
+  /**
+   * @brief Flag the scenes as changed, i.e. to be saved by persist().
+   *
+   */
+  void markChanged() { mIsChanged = true; }
+
+  /**
+   * @brief Check whether all changes of the scenes have been saved.
+   *
+   * @return true - no change is pending and no save is running
+   * @return false - otherwise
+   */
+  bool isSaved() const { return !mIsChanged && !mIsPending && !mIsSaving; }
+
+  /**
+   * @brief Advance the lazy save of the scenes.
+   *
+   * @param[in] now_ms the current time in ms, e.g. millis()
+   */
+  void persist(const uint32_t now_ms) {
+    if (mIsChanged) {
+      mIsChanged = false;
+      mIsPending = true;
+      mChangedAt = now_ms;
+    }
+
+    if ((nullptr != mStore) && mIsPending && !mIsSaving && ((now_ms - mChangedAt) >= mSaveDelay)) {
+      mIsPending = false;
+      mIsSaving = true;
+      mIsInvalidated = false;
+      mCursor = 0;
+      mCrc = 0;
+    }
+
+    bool isWritten = false;
+
+    for (uint8_t count = 0; mIsSaving && !isWritten && (count < kSceneSaveBudget); count++) {
+      const uint16_t address = (mCursor + kSceneBankHeaderSize) % size();  // the header last
+      const uint8_t value = imageByte(address);
+
+      const bool isBody = (address >= kSceneBankHeaderSize);
+
+      if (!mIsInvalidated && isBody && (mStore->read(address) != value)) {
+        mIsInvalidated = true;
+        isWritten = mStore->update(0, kSceneBankInvalid);  // no write if already invalid
+      } else {
+        isWritten = mStore->update(address, value);
+        mCrc = isBody ? crc8(mCrc, value) : mCrc;  // the checksum of the bytes actually saved
+        mCursor++;
+      }
+
+      if (mCursor >= size()) {
+        mIsSaving = false;
+        mCursor = 0;
+      }
+    }
+  }
+
+  /**
+   * @brief Returns the size of the scene bank in the store.
+   *
+   * @return uint16_t - the number of bytes
+   */
+  static constexpr uint16_t size() { return kSceneBankHeaderSize + N * sizeof(Scene); }
+
+ private:
+  /**
+   * @brief Get a byte of the header.
+   *
+   * @param[in] idx the index of the byte in the range [0, kSceneBankHeaderSize - 1]
+   * @param[in] crc the CRC-8 of the scene images
+   * @return uint8_t - the value of the byte
+   */
+  static uint8_t headerByte(const uint8_t idx, const uint8_t crc) {
+    const uint8_t header[kSceneBankHeaderSize] = {(uint8_t)kSceneBankMagic,
+                                                  (uint8_t)(kSceneBankMagic >> 8),
+                                                  kSceneBankVersion,
+                                                  N,
+                                                  (uint8_t)sizeof(Scene),
+                                                  (uint8_t)(sizeof(Scene) >> 8),
+                                                  crc};
+
+    return header[idx];
+  }
+
+  /**
+   * @brief Update a CRC-8 with the next byte.
+   *
+   * @param[in] crc the CRC-8 of the preceding bytes, 0 for the first byte
+   * @param[in] value the next byte
+   * @return uint8_t - the updated CRC-8
+   */
+  static uint8_t crc8(const uint8_t crc, const uint8_t value) {
+    uint8_t returnValue = crc ^ value;
+
+    for (uint8_t bit = 0; bit < 8; bit++) {
+      returnValue = (uint8_t)((returnValue << 1) ^ ((returnValue & 0x80) ? kSceneBankCrcPoly : 0));
+    }
+
+    return returnValue;
+  }
+
+  /**
+   * @brief Get a byte of the scene bank.
+   *
+   * @param[in] address the address of the byte in the range [0, size() - 1]
+   * @return uint8_t - the value of the byte
+   */
+  uint8_t imageByte(const uint16_t address) const {
+    uint8_t returnValue = 0;
+
+    if (address < kSceneBankHeaderSize) {
+      returnValue = headerByte(address, mCrc);  // the checksum of the saved scene images
+    } else {
+      const uint16_t offset = address - kSceneBankHeaderSize;
+      returnValue = ((const uint8_t*)mScenes[offset / sizeof(Scene)])[offset % sizeof(Scene)];
+    }
+
+    return returnValue;
+  }
+
+  ISceneStore* mStore;  /**< the store, nullptr if the scenes are not persisted */
+  Scene* mScenes[N];    /**< the scenes of the scene bank */
+  uint16_t mSaveDelay;  /**< the time in ms the scenes must be unchanged before saving */
+  uint32_t mChangedAt;  /**< the time of the last change in ms */
+  uint16_t mCursor;     /**< the position of the running save */
+  bool mIsChanged;      /**< the scenes changed since the last persist() call */
+  bool mIsPending;      /**< a save is pending until the save delay elapsed */
+  bool mIsSaving;       /**< a save is running */
+  bool mIsInvalidated;  /**< the header got invalidated by the running save */
+  uint8_t mCrc;         /**< the CRC-8 of the scene bytes saved by the running save */
+};
+}  // namespace mididmxbridge::dmx
+#endif
@@ -0,0 +1,260 @@
+/**
+ * @file TraceRing.h
+ * @author Christian Neukam
+ * @brief Binary trace facility of the mididmxbridge library.
+ * @version 1.0
+ * @date 2024-03-10
+ *
+ * @copyright Copyright 2024 Christian Neukam. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef __MIDIDMXBRIDGE_TRACE_RING_H__
+#define __MIDIDMXBRIDGE_TRACE_RING_H__
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "RingBuffer.h"
+
+namespace mididmxbridge {
+const uint8_t kTraceRecordSize = 8;  /**< the size of a serialized trace record in bytes */
+const uint8_t kTraceSyncByte = 0xa5; /**< the first byte of every serialized trace record */
+
+/**
+ * @brief This struct defines a trace record of a DMX change.
+ *
+ * A record is serialized into ::kTraceRecordSize bytes: the sync byte ::kTraceSyncByte, followed by
+ * the timestamp (4 bytes), the channel (2 bytes), both little-endian, and the value (1 byte).
+ *
+ */
+struct TraceRecord {
+  uint32_t time_ms; /**< the time of the DMX change in ms */
+  uint16_t channel; /**< the DMX channel */
+  uint8_t value;    /**< the DMX value */
+};
+
+/**
+ * @brief Decode a serialized trace record.
+ *
+ * @param[in] data the serialized record, must hold at least ::kTraceRecordSize bytes
+ * @param[out] record the decoded record, only updated if `true` is returned
+ * @return true - the record got decoded
+ * @return false - \p data does not start with ::kTraceSyncByte
+ */
+inline bool decodeTraceRecord(const uint8_t* data, TraceRecord& record) {
+  bool returnValue = false;
+
+  if (kTraceSyncByte == data[0]) {
+    record.time_ms = (uint32_t)data[1] | ((uint32_t)data[2] << 8) | ((uint32_t)data[3] << 16) |
+                     ((uint32_t)data[4] << 24);
+    record.channel = (uint16_t)(data[5] | (data[6] << 8));
+    record.value = data[7];
+    returnValue = true;
+  }
+
+  return returnValue;
+}
+
+/**
+ * @brief This class decodes a stream of serialized trace records, e.g. a capture of the serial
+ * port.
+ *
+ * Bytes not belonging to a record, e.g. after connecting to a running board or after a lost byte,
+ * are skipped. As the payload of a record may contain ::kTraceSyncByte as well, the decoder only
+ * locks onto a position if the next record starts ::kTraceRecordSize bytes later, too. While
+ * locked, every record must start with the sync byte, otherwise the lock is lost.
+ *
+ */
+class TraceStreamDecoder {
+ public:
+  /**
+   * @brief Construct a new TraceStreamDecoder object, which is not locked onto the stream.
+   *
+   */
+  TraceStreamDecoder() : mWindow(), mSize(0), mIsLocked(false) {}
+
+  /**
+   * @brief Decode the next byte of the stream.
+   *
+   * @param[in] byte the next byte
+   * @param[out] record the decoded record, only updated if `true` is returned
+   * @return true - a record got decoded
+   * @return false - otherwise
+   */
+  bool decode(const uint8_t byte, TraceRecord& record) {
+    bool returnValue = false;
+
+    mWindow[mSize++] = byte;
+
+    if (mIsLocked && (mSize >= kTraceRecordSize)) {
+      mIsLocked = decodeTraceRecord(mWindow, record);
+      returnValue = mIsLocked;
+      skip(mIsLocked ? kTraceRecordSize : 1);
+    } else if (!mIsLocked && (mSize == sizeof(mWindow))) {
+      const bool isNextSync = (kTraceSyncByte == mWindow[kTraceRecordSize]);
+
+      mIsLocked = isNextSync && decodeTraceRecord(mWindow, record);
+      returnValue = mIsLocked;
+      skip(mIsLocked ? kTraceRecordSize : 1);
+    }
+
+    return returnValue;
+  }
+
+  /**
+   * @brief Decode the last record at the end of the stream.
+   *
+   * The end of the stream takes the place of the next sync byte, i.e. a record ending exactly at
+   * the end of the stream is decoded.
+   *
+   * @param[out] record the decoded record, only updated if `true` is returned
+   * @return true - a record got decoded
+   * @return false - otherwise
+   */
+  bool finish(TraceRecord& record) {
+    const bool returnValue = (mSize >= kTraceRecordSize) &&
+                             decodeTraceRecord(&mWindow[mSize - kTraceRecordSize], record);
+
+    mSize = 0;
+    mIsLocked = false;
+
+    return returnValue;
+  }
+
+ private:
+  /**
+   * @brief Discard the oldest bytes of the window.
+   *
+   * @param[in] count the number of bytes to discard, at most the number of bytes in the window
+   */
+  void skip(const uint8_t count) {
+    for (uint8_t idx = count; idx < mSize; idx++) {
+      mWindow[idx - count] = mWindow[idx];
+    }
+    mSize -= count;
+  }
+
+  uint8_t mWindow[2 * kTraceRecordSize]; /**< the bytes of the current and the next record */
+  uint8_t mSize;                         /**< the number of bytes in the window */
+  bool mIsLocked;                        /**< true once the window starts at a record */
+};
+
+/**
+ * @brief This class provides a low-overhead binary trace of DMX changes.
+ *
+ * In contrast to formatting a text per DMX change, recording a trace only copies a fixed-size
+ * binary record into a static ring buffer, i.e. neither heap memory is allocated nor the loop is
+ * blocked by the serial output. The ring buffer is drained via drain() whenever the output has room
+ * for complete records, e.g. at the end of each loop() call. The records can be decoded on the host
+ * via decodeTraceRecord(), e.g. with the \p tracedecoder tool.
+ *
+ * If the ring buffer is full, new records are discarded and counted, see dropped().
+ *
+ * @tparam N the size of the ring buffer in bytes, must be a power of two in the range [16, 256]
+ */
+template <uint16_t N = 128>
+class TraceRing {
+  static_assert(N >= 2 * kTraceRecordSize, "N must hold at least one record");
+
+ public:
+  /**
+   * @brief Construct a new, empty TraceRing object.
+   *
+   */
+  TraceRing() : mBuffer(), mDropped(0) {}
+
+  /**
+   * @brief Append a record of a DMX change to the trace.
+   *
+   * @param[in] time_ms the time of the DMX change in ms, e.g. millis()
+   * @param[in] channel the DMX channel
+   * @param[in] value the DMX value
+   * @return true - the record got appended
+   * @return false - the ring buffer is full, the record got discarded
+   */
+  bool record(const uint32_t time_ms, const uint16_t channel, const uint8_t value) {
+    bool returnValue = false;
+
+    if ((mBuffer.capacity() - mBuffer.size()) >= kTraceRecordSize) {
+      mBuffer.push(kTraceSyncByte);
+      mBuffer.push((uint8_t)time_ms);
+      mBuffer.push((uint8_t)(time_ms >> 8));
+      mBuffer.push((uint8_t)(time_ms >> 16));
+      mBuffer.push((uint8_t)(time_ms >> 24));
+      mBuffer.push((uint8_t)channel);
+      mBuffer.push((uint8_t)(channel >> 8));
+      mBuffer.push(value);
+      returnValue = true;
+    } else {
+      mDropped++;
+    }
+
+    return returnValue;
+  }
+
+  /**
+   * @brief Write the pending records to an output without blocking.
+   *
+   * Only complete records are written and only as many as the output accepts without blocking,
+   * e.g. the Arduino Serial object.
+   *
+   * @tparam Output the type of the output, providing \p availableForWrite() and
+   * \p write(const uint8_t*, size_t) like the Arduino Print API
+   * @param[in,out] out the output to write the records to
+   * @return size_t - the number of bytes written
+   */
+  template <class Output>
+  size_t drain(Output& out) {
+    uint8_t chunk[kTraceRecordSize];
+    size_t returnValue = 0;
+    int room = out.availableForWrite();
+
+    while ((room >= kTraceRecordSize) && !mBuffer.empty()) {
+      mBuffer.pop(chunk, kTraceRecordSize);
+      out.write(chunk, kTraceRecordSize);
+      room -= kTraceRecordSize;
+      returnValue += kTraceRecordSize;
+    }
+
+    return returnValue;
+  }
+
+  /**
+   * @brief Returns the number of pending records.
+   *
+   * @return uint8_t - the number of records not yet drained
+   */
+  uint8_t size() const { return mBuffer.size() / kTraceRecordSize; }
+
+  /**
+   * @brief Checks if no records are pending.
+   *
+   * @return true if all records got drained
+   * @return false otherwise
+   */
+  bool empty() const { return mBuffer.empty(); }
+
+  /**
+   * @brief Returns the number of records discarded because the ring buffer was full.
+   *
+   * @return uint16_t - the number of discarded records, wraps around at 65536
+   */
+  uint16_t dropped() const { return mDropped; }
+
+ private:
+  RingBuffer<uint8_t, N> mBuffer; /**< the serialized records */
+  uint16_t mDropped;              /**< the number of discarded records */
+};
+}  // namespace mididmxbridge
+#endif
@@ -24,9 +24,81 @@
 
 #include <stdint.h>
 
+#ifndef MIDIDMXBRIDGE_USE_GAIN_LUT
+#define MIDIDMXBRIDGE_USE_GAIN_LUT 1 /**< 1: apply the DMX gain via a 128 byte lookup table */
+#endif
+
+#ifndef MIDIDMXBRIDGE_USE_FRAME_MODE
+#define MIDIDMXBRIDGE_USE_FRAME_MODE 1 /**< 1: support the frame mode, frame callback and poll() */
+#endif
+
+#ifndef MIDIDMXBRIDGE_USE_SINKS
+#define MIDIDMXBRIDGE_USE_SINKS 1 /**< 1: support mirroring the DMX frame to several sinks */
+#endif
+
+#ifndef MIDIDMXBRIDGE_USE_HIGH_RES
+#define MIDIDMXBRIDGE_USE_HIGH_RES 1 /**< 1: support 14-bit MIDI CC, NRPN and 16-bit DMX values */
+#endif
+
+#ifndef MIDIDMXBRIDGE_STATS
+#define MIDIDMXBRIDGE_STATS 0 /**< 1: collect the runtime statistics of MidiDmxBridge::listen() */
+#endif
+
+#ifndef MIDIDMXBRIDGE_MAX_DMX_CHANNEL
+#define MIDIDMXBRIDGE_MAX_DMX_CHANNEL 127 /**< highest DMX address, up to 512 as SRAM allows */
+#endif
+
+#ifndef MIDIDMXBRIDGE_MAX_PATCHES
+#define MIDIDMXBRIDGE_MAX_PATCHES 16 /**< max. number of MIDI CC to DMX address patches */
+#endif
+
+#ifndef MIDIDMXBRIDGE_COALESCE_SIZE
+#define MIDIDMXBRIDGE_COALESCE_SIZE 16 /**< max. distinct MIDI CC coalesced per listen() batch */
+#endif
+
+#ifndef MIDIDMXBRIDGE_MAX_RGB_CHANNELS
+#define MIDIDMXBRIDGE_MAX_RGB_CHANNELS 8 /**< max. DMX channels per primary color, in [1, 255] */
+#endif
+
+#ifndef MIDIDMXBRIDGE_STATIC_SCENE_SLOTS
+#define MIDIDMXBRIDGE_STATIC_SCENE_SLOTS 2 /**< number of static scene presets, in [1, 255] */
+#endif
+
+#ifndef MIDIDMXBRIDGE_MAX_SINKS
+#define MIDIDMXBRIDGE_MAX_SINKS 2 /**< max. number of frame sinks, in [1, 255] */
+#endif
+
+#ifndef MIDIDMXBRIDGE_USE_FRAME_KERNELS
+#ifdef ARDUINO
+#define MIDIDMXBRIDGE_USE_FRAME_KERNELS 0 /**< keeps the per-channel loops and their small stack */
+#else
+#define MIDIDMXBRIDGE_USE_FRAME_KERNELS 1 /**< 1: diff scenes via whole-frame (SIMD) kernels */
+#endif
+#endif
+
 namespace mididmxbridge {
 const uint8_t kMaxMidiValue = 0x7f;                      /**< maximum possible MIDI value */
+const uint8_t kMaxMidiChannel = 16;                      /**< highest nominal MIDI channel */
 const uint8_t kAnalogReadBits = 10;                      /**< bit resolution of analog read */
 const uint16_t kUnityGainValue = (1 << kAnalogReadBits); /**< factor for unity gain */
+const uint8_t kDefaultListenBudget = 16;                 /**< max. MIDI messages per listen() */
+const uint16_t kDefaultIdleSleepMs = 3;                  /**< idle sleep of listen() in ms */
+const uint8_t kSerialChunkSize = 16;                     /**< bytes fetched per serial bulk read */
+const uint8_t kDefaultFadeBudget = 16;                   /**< max. DMX channels faded per tick */
+const uint8_t kDefaultRefreshBudget = 16;                /**< max. channels refreshed per tick */
+const uint8_t kDefaultFrameRate = 44;                    /**< DMX frames per second of poll() */
+const uint16_t kDefaultSceneSaveDelayMs = 5000;          /**< quiet time before saving scenes */
+const uint8_t kSceneSaveBudget = 16;                     /**< max. bytes compared per save step */
+const uint16_t kDefaultAttenuationIntervalMs = 10;       /**< interval of attenuation samples */
+const uint8_t kMaxRgbChannels = MIDIDMXBRIDGE_MAX_RGB_CHANNELS; /**< DMX channels per color */
+const uint16_t kMaxDmxChannel = MIDIDMXBRIDGE_MAX_DMX_CHANNEL;  /**< highest DMX address */
+const uint8_t kMaxPatches = MIDIDMXBRIDGE_MAX_PATCHES;          /**< capacity of the patch map */
+const uint8_t kCoalesceSize = MIDIDMXBRIDGE_COALESCE_SIZE;      /**< capacity of the coalescer */
+const uint8_t kMaxSinks = MIDIDMXBRIDGE_MAX_SINKS;              /**< capacity of the frame sinks */
+const uint8_t kStaticSceneSlots = MIDIDMXBRIDGE_STATIC_SCENE_SLOTS; /**< static scene presets */
+
+static_assert((kMaxDmxChannel > 0) && (kMaxDmxChannel <= 512), "a DMX universe has 512 slots");
+static_assert(kStaticSceneSlots > 0, "at least one static scene preset is required");
+static_assert(kMaxSinks > 0, "at least one frame sink is required");
 }  // namespace mididmxbridge
 #endif
@@ -0,0 +1,194 @@
+/**
+ * @file static_vector.h
+ * @author Christian Neukam
+ * @brief Utilities of the mididmxbridge library.
+ * @version 1.0
+ * @date 2024-02-25
+ *
+ * @copyright Copyright 2024 Christian Neukam. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef __MIDIDMXBRIDGE_STATIC_VECTOR_H__
+#define __MIDIDMXBRIDGE_STATIC_VECTOR_H__
+
+#include <stdint.h>
+
+namespace mididmxbridge {
+/**
+ * @brief This class provides a vector with a capacity fixed at compile time.
+ *
+ * In contrast to mididmxbridge::vector, the elements are stored in place and no dynamic memory is
+ * allocated, i.e. the heap of the microcontroller cannot fragment. An initializer array exceeding
+ * the capacity fails to compile. Elements appended at runtime beyond the capacity are discarded,
+ * which push_back() reports by returning false.
+ *
+ * @warning This class is not standard compliant.
+ *
+ * @tparam T - The type of the elements.
+ * @tparam N - The capacity of the container in the range [1, 255].
+ */
+template <class T, uint8_t N>
+class static_vector {
+  static_assert(N > 0, "the capacity shall not be 0");
+
+ public:
+  /**
+   * @brief Construct a new static_vector object.
+   *
+   * Default constructor. Constructs an empty container.
+   *
+   */
+  static_vector() : mData(), mSize(0) {}
+
+  /**
+   * @brief Construct a new static_vector object.
+   *
+   * Constructs the container with count default-inserted instances of T. The size is clipped to the
+   * capacity.
+   *
+   * @param count the size of the container
+   */
+  explicit static_vector(const uint8_t count) : mData(), mSize((count < N) ? count : N) {}
+
+  /**
+   * @brief Construct a new static_vector object.
+   *
+   * Constructs the container with the contents of the initializer array values, e.g.
+   * `static_vector<uint16_t, 8> channels({1, 2, 3})`. An array exceeding the capacity fails to
+   * compile.
+   *
+   * @tparam M - The number of values.
+   * @param values the values to initialize elements of the container with
+   */
+  template <uint8_t M>
+  static_vector(const T (&values)[M]) : mData(), mSize(0) {
+    static_assert(M <= N, "the initializer array shall not exceed the capacity");
+    for (uint8_t idx = 0; idx < M; idx++) {
+      push_back(values[idx]);
+    }
+  }
+
+  /**
+   * @brief Construct a new static_vector object.
+   *
+   * Constructs the container with the first count values of the array values. Values exceeding the
+   * capacity are discarded, i.e. size() is less than count.
+   *
+   * @param count the size of the container
+   * @param values the values to initialize elements of the container with
+   */
+  static_vector(const uint8_t count, const T values[]) : mData(), mSize(0) {
+    for (uint8_t idx = 0; idx < count; idx++) {
+      push_back(values[idx]);
+    }
+  }
+
+  /**
+   * @brief Checks if the container has no elements.
+   *
+   * @return true if the container is empty
+   * @return false otherwise
+   */
+  bool empty() const { return (0 == mSize) ? true : false; }
+
+  /**
+   * @brief Checks if the container is filled up to its capacity.
+   *
+   * @return true if no more elements can be appended
+   * @return false otherwise
+   */
+  bool full() const { return (N == mSize) ? true : false; }
+
+  /**
+   * @brief Appends the given element value to the end of the container.
+   *
+   * The value is discarded if the container is full.
+   *
+   * @param value the value of the element to append
+   * @return true if the value has been appended
+   * @return false if the value has been discarded
+   */
+  bool push_back(const T& value) {
+    bool returnValue = false;
+
+    if (mSize < N) {
+      mData[mSize] = value;
+      mSize++;
+      returnValue = true;
+    }
+
+    return returnValue;
+  }
+
+  /**
+   * @brief Removes the last element of the container.
+   *
+   */
+  void pop_back() {
+    if (mSize > 0) {
+      mSize--;
+      mData[mSize] = T{};
+    }
+  }
+
+  /**
+   * @brief Erases all elements from the container.
+   *
+   */
+  void clear() {
+    while (mSize > 0) {
+      pop_back();
+    }
+  }
+
+  /**
+   * @brief Returns the number of elements in the container.
+   *
+   * @return uint8_t - the number of elements in the container
+   */
+  uint8_t size() const { return mSize; }
+
+  /**
+   * @brief Returns the maximum number of elements the container is able to hold.
+   *
+   * @return uint8_t - the maximum number of elements.
+   */
+  static constexpr uint8_t max_size() { return N; }
+
+  /**
+   * @brief Returns the number of elements that the container has space for.
+   *
+   * @return uint8_t - the capacity of the storage.
+   */
+  static constexpr uint8_t capacity() { return N; }
+
+  ///@{
+  /**
+   * @brief Returns a reference to the element at specified location pos.
+   *
+   * @warning No bounds checking is performed.
+   *
+   * @param pos the position of the element to return
+   * @return T& - the reference to the requested element.
+   */
+  T& operator[](uint8_t pos) { return mData[pos]; }
+  const T& operator[](uint8_t pos) const { return mData[pos]; }
+  ///@}
+
+ private:
+  T mData[N];    /**< the raw data array */
+  uint8_t mSize; /**< the current size of the container */
+};
+}  // namespace mididmxbridge
+#endif
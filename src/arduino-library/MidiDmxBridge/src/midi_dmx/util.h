@@ -22,6 +22,8 @@
 #ifndef __MIDIDMXBRIDGE_UTIL_H__
 #define __MIDIDMXBRIDGE_UTIL_H__
 
+#include <stdint.h>
+
 namespace mididmxbridge::util {
 /**
  * @brief constexpr definition of the min operation.
@@ -61,5 +63,79 @@ template <typename T>
 constexpr T absDiff_t(const T x, const T y) {
   return (x > y) ? (x - y) : (y - x);
 }
+
+/**
+ * @brief constexpr definition of the power series of the exponential function.
+ *
+ * @tparam T the floating-point type, e.g. double
+ * @param[in] x the non-negative exponent
+ * @param[in] n the index of the current term
+ * @param[in] term the current term x^n / n!
+ * @return T - the sum of the current and all following terms
+ */
+template <typename T>
+constexpr T expSeries_t(const T x, const uint8_t n, const T term) {
+  return (n >= 48) ? term : term + expSeries_t(x, n + 1, term * x / (n + 1));
+}
+
+/**
+ * @brief constexpr definition of the exponential function, e.g. to generate tables at compile time.
+ *
+ * The power series only adds positive terms, i.e. negative exponents are evaluated as 1 / e^-x.
+ * The result is accurate for |x| < 16.
+ *
+ * @tparam T the floating-point type, e.g. double
+ * @param[in] x the exponent
+ * @return T - e raised to the power of \p x
+ */
+template <typename T>
+constexpr T exp_t(const T x) {
+  return (x < 0) ? (1 / expSeries_t(-x, 0, (T)1)) : expSeries_t(x, 0, (T)1);
+}
+
+/**
+ * @brief constexpr definition of the series 2 * artanh(y) = ln((1 + y) / (1 - y)).
+ *
+ * @tparam T the floating-point type, e.g. double
+ * @param[in] y2 the square of y
+ * @param[in] power the current power y^n
+ * @param[in] n the odd index of the current term
+ * @return T - the sum of the current and all following terms
+ */
+template <typename T>
+constexpr T logSeries_t(const T y2, const T power, const uint8_t n) {
+  return (n >= 41) ? 0 : 2 * power / n + logSeries_t(y2, power * y2, n + 2);
+}
+
+/**
+ * @brief constexpr definition of the natural logarithm, e.g. to generate tables at compile time.
+ *
+ * The argument is doubled or halved into the range [0.5, 2], where the series converges quickly,
+ * i.e. the recursion depth grows with |log2(x)|.
+ *
+ * @tparam T the floating-point type, e.g. double
+ * @param[in] x the positive argument
+ * @return T - the natural logarithm of \p x
+ */
+template <typename T>
+constexpr T log_t(const T x) {
+  return (x < (T)0.5) ? (log_t(2 * x) - (T)0.69314718055994531)
+         : (x > (T)2)  ? (log_t(x / 2) + (T)0.69314718055994531)
+                       : logSeries_t(((x - 1) / (x + 1)) * ((x - 1) / (x + 1)), (x - 1) / (x + 1),
+                                     (uint8_t)1);
+}
+
+/**
+ * @brief constexpr definition of the power function, e.g. to generate tables at compile time.
+ *
+ * @tparam T the floating-point type, e.g. double
+ * @param[in] x the non-negative base
+ * @param[in] y the exponent
+ * @return T - \p x raised to the power of \p y, 0 if \p x is not positive
+ */
+template <typename T>
+constexpr T pow_t(const T x, const T y) {
+  return (x > 0) ? exp_t(y * log_t(x)) : 0;
+}
 }  // namespace mididmxbridge::util
 #endif
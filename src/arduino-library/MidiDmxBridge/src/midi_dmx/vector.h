@@ -186,7 +186,7 @@ class vector {
         data[idx] = mData[idx];
       }
 
-      delete mData;
+      delete[] mData;
       mData = data;
       mCapacity = newCapacity;
     }
@@ -0,0 +1,267 @@
+/**
+ * @file MidiDmxBridgeBenchmarks.cpp
+ * @author Christian Neukam
+ * @brief Benchmarks of the MIDI to DMX pipeline of the MidiDmxBridge library.
+ * @version 1.0
+ * @date 2024-03-09
+ *
+ * @copyright Copyright 2024 Christian Neukam. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <benchmark/benchmark.h>
+
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iterator>
+#include <string>
+
+#include "MidiDmxBridge.h"
+#include "midi_dmx/FrameKernels.h"
+#include "SerialReaderReplay.h"
+
+namespace mididmxbridge::benchmarks {
+static const size_t kMessages = 240; /**< the MIDI CC messages per iteration, below any budget */
+static const size_t kMessageSize = 3; /**< the bytes of a MIDI CC message with its status byte */
+
+/**
+ * @brief Load a recorded MIDI byte stream.
+ *
+ * @param[in] path the path of a file containing the raw MIDI bytes
+ * @return std::vector<uint8_t> - the MIDI byte stream, empty if the file cannot be read
+ */
+static std::vector<uint8_t> recordedStream(const std::string& path) {
+  std::ifstream file(path, std::ios::binary);
+  return {std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()};
+}
+
+/**
+ * @brief Get the MIDI byte stream to replay through the complete pipeline.
+ *
+ * The environment variable \p MIDIDMXBRIDGE_BENCHMARK_STREAM may point to a file holding a recorded
+ * MIDI byte stream on MIDI channel 1, otherwise a synthetic stream is used.
+ *
+ * @return std::vector<uint8_t> - the MIDI byte stream
+ */
+static std::vector<uint8_t> pipelineStream() {
+  const char* path = std::getenv("MIDIDMXBRIDGE_BENCHMARK_STREAM");
+  auto stream = (nullptr != path) ? recordedStream(path) : std::vector<uint8_t>{};
+
+  return stream.empty() ? syntheticStream(kMessages, 1, false) : stream;
+}
+
+/**
+ * @brief Report the throughput counters of a benchmark.
+ *
+ * The counter time/msg is the inverse throughput, i.e. the mean processing time per message of a
+ * burst. The latency from the arrival of a message to its DMX callback is reported by
+ * BM_MidiDmxBridge_latency.
+ *
+ * @param[in,out] state the benchmark state
+ * @param[in] messages the number of MIDI CC messages processed in total
+ * @param[in] callbacks the number of DMX callbacks triggered in total
+ */
+static void reportCounters(::benchmark::State& state, const size_t messages,
+                           const size_t callbacks) {
+  using ::benchmark::Counter;
+
+  state.SetItemsProcessed((int64_t)messages);
+  state.counters["callbacks/msg"] = Counter((double)callbacks / (double)messages);
+  state.counters["time/msg"] = Counter((double)messages, Counter::kIsRate | Counter::kInvert);
+}
+
+/**
+ * @brief Benchmark the decoding of MIDI CC messages by mididmxbridge::midi::MidiReader.
+ *
+ * @param[in,out] state the benchmark state, range(0) selects running status
+ */
+static void BM_MidiReader_readCc(::benchmark::State& state) {
+  SerialReaderReplay serial(syntheticStream(kMessages, 1, state.range(0) != 0));
+  mididmxbridge::midi::MidiReader reader(1, serial);
+  size_t messages = 0;
+  uint8_t controller;
+  uint8_t value;
+
+  for (auto _ : state) {
+    serial.rewind();
+
+    while (reader.readCc(controller, value)) {
+      messages++;
+    }
+    ::benchmark::DoNotOptimize(value);
+  }
+
+  reportCounters(state, messages, 0);
+}
+BENCHMARK(BM_MidiReader_readCc)->ArgName("running_status")->Arg(0)->Arg(1);
+
+/**
+ * @brief Benchmark the conversion of MIDI CC values to DMX values by mididmxbridge::dmx::Dmx.
+ *
+ * @param[in,out] state the benchmark state, range(0) selects the frame-based mode
+ */
+static void BM_Dmx_setMidiCcValue(::benchmark::State& state) {
+  size_t callbacks = 0;
+  size_t messages = 0;
+  mididmxbridge::dmx::Dmx dmx([&](const uint16_t, const uint8_t) { callbacks++; });
+
+  dmx.setFrameMode(state.range(0) != 0);
+
+  for (auto _ : state) {
+    for (size_t msg = 0; msg < kMessages; msg++) {
+      dmx.setMidiCcValue((uint8_t)((msg * 5) & 0x7f), (uint8_t)((msg * 3 + messages) & 0x7f));
+    }
+    dmx.flush();
+    messages += kMessages;
+  }
+
+  reportCounters(state, messages, callbacks);
+}
+BENCHMARK(BM_Dmx_setMidiCcValue)->ArgName("frame_mode")->Arg(0)->Arg(1);
+
+/**
+ * @brief Benchmark the frame kernels, i.e. scaling and diffing one 512 channel DMX universe.
+ *
+ * @param[in,out] state the benchmark state
+ */
+static void BM_FrameKernels_scaleAndDiff(::benchmark::State& state) {
+  uint8_t scene[512];
+  uint8_t frame[sizeof(scene)];
+  uint8_t target[sizeof(scene)];
+  uint8_t changed[sizeof(scene) / 8];
+  uint16_t gain = 0;
+
+  for (uint16_t idx = 0; idx < sizeof(scene); idx++) {
+    scene[idx] = (uint8_t)(idx * 37 + 11);
+    frame[idx] = (uint8_t)(idx * 5);
+  }
+
+  for (auto _ : state) {
+    mididmxbridge::dmx::scaleFrame(scene, target, sizeof(scene), gain);
+    ::benchmark::DoNotOptimize(
+        mididmxbridge::dmx::diffFrame(target, frame, sizeof(scene), changed));
+    ::benchmark::ClobberMemory();
+    gain = (gain + 1) & 0x3ff;
+  }
+
+  state.SetBytesProcessed(state.iterations() * sizeof(scene));
+}
+BENCHMARK(BM_FrameKernels_scaleAndDiff);
+
+/**
+ * @brief Benchmark the complete pipeline of BasicMidiDmxBridge::listen().
+ *
+ * @tparam Bridge the bridge type, i.e. MidiDmxBridge or a BasicMidiDmxBridge bound to the concrete
+ * serial reader type
+ * @param[in,out] state the benchmark state, range(0) selects the frame-based mode, range(1) the
+ * coalescing of MIDI CC messages
+ */
+template <class Bridge>
+static void BM_MidiDmxBridge_listen(::benchmark::State& state) {
+  const auto stream = pipelineStream();
+  size_t callbacks = 0;
+  size_t messages = 0;
+  SerialReaderReplay serial(stream);
+  mididmxbridge::midi::MidiReader counter(1, serial);
+  Bridge bridge(1, [&](const uint16_t, const uint8_t) { callbacks++; }, serial);
+  uint8_t controller;
+  uint8_t value;
+
+  while (counter.readCc(controller, value)) {
+    messages++;  // the number of MIDI CC messages in the stream
+  }
+
+  bridge.setIdleSleep(0);
+  bridge.setListenBudget(0xff);
+  bridge.setFrameMode(state.range(0) != 0);
+  bridge.setCoalescing(state.range(1) != 0);
+
+  for (auto _ : state) {
+    serial.rewind();
+
+    while (serial.available() > 0) {
+      bridge.listen();
+    }
+    bridge.listen();  // drain the local buffer of the MIDI reader
+  }
+
+  reportCounters(state, messages * state.iterations(), callbacks);
+}
+BENCHMARK_TEMPLATE(BM_MidiDmxBridge_listen, MidiDmxBridge)
+    ->ArgNames({"frame_mode", "coalescing"})
+    ->ArgsProduct({{0, 1}, {0, 1}});
+BENCHMARK_TEMPLATE(BM_MidiDmxBridge_listen, BasicMidiDmxBridge<SerialReaderReplay>)
+    ->ArgNames({"frame_mode", "coalescing"})
+    ->ArgsProduct({{0, 1}, {0, 1}});
+
+/**
+ * @brief Benchmark the latency of BasicMidiDmxBridge::listen() from the arrival of the bytes of a
+ * MIDI CC message to its first DMX callback.
+ *
+ * The messages arrive one at a time, i.e. every listen() call finds a single message. The counter
+ * latency_ns is the mean latency of the messages triggering a DMX callback in ns.
+ *
+ * @tparam Bridge the bridge type, i.e. MidiDmxBridge or a BasicMidiDmxBridge bound to the concrete
+ * serial reader type
+ * @param[in,out] state the benchmark state, range(0) selects the frame-based mode
+ */
+template <class Bridge>
+static void BM_MidiDmxBridge_latency(::benchmark::State& state) {
+  using Clock = std::chrono::steady_clock;
+
+  const auto stream = syntheticStream(kMessages, 1, false);
+  SerialReaderReplay serial(stream);
+  Clock::time_point arrival;
+  Clock::duration latency = Clock::duration::zero();
+  bool isPending = false;
+  size_t delivered = 0;
+  Bridge bridge(
+      1,
+      [&](const uint16_t, const uint8_t) {
+        if (isPending) {
+          latency += Clock::now() - arrival;
+          isPending = false;
+          delivered++;
+        }
+      },
+      serial);
+
+  bridge.setIdleSleep(0);
+  bridge.setFrameMode(state.range(0) != 0);
+
+  for (auto _ : state) {
+    serial.rewind();
+
+    for (size_t msg = 0; msg < kMessages; msg++) {
+      serial.release(kMessageSize);
+      isPending = true;
+      arrival = Clock::now();
+      bridge.listen();
+    }
+  }
+
+  const auto latency_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(latency).count();
+
+  state.SetItemsProcessed((int64_t)(kMessages * state.iterations()));
+  state.counters["latency_ns"] =
+      ::benchmark::Counter((delivered > 0) ? ((double)latency_ns / (double)delivered) : 0.0);
+}
+BENCHMARK_TEMPLATE(BM_MidiDmxBridge_latency, MidiDmxBridge)->ArgName("frame_mode")->Arg(0)->Arg(1);
+BENCHMARK_TEMPLATE(BM_MidiDmxBridge_latency, BasicMidiDmxBridge<SerialReaderReplay>)
+    ->ArgName("frame_mode")
+    ->Arg(0)
+    ->Arg(1);
+}  // namespace mididmxbridge::benchmarks
+
+BENCHMARK_MAIN();
@@ -0,0 +1,117 @@
+/**
+ * @file SerialReaderReplay.h
+ * @author Christian Neukam
+ * @brief Replay implementation of the mididmxbridge::ISerialReader interface for benchmarks.
+ * @version 1.0
+ * @date 2024-03-09
+ *
+ * @copyright Copyright 2024 Christian Neukam. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+#include "ISerialReader.h"
+
+namespace mididmxbridge::benchmarks {
+/**
+ * @brief This class replays a MIDI byte stream via the mididmxbridge::ISerialReader interface.
+ *
+ * The reader never blocks or sleeps, i.e. the benchmarks only measure the MIDI to DMX pipeline. By
+ * default the whole stream is available at once, release() holds back the bytes beyond the next
+ * ones instead, e.g. to measure the latency of single messages.
+ *
+ */
+class SerialReaderReplay final : public mididmxbridge::ISerialReader {
+ public:
+  /**
+   * @brief Construct a new SerialReaderReplay object.
+   *
+   * @param[in] data the MIDI byte stream to replay
+   */
+  SerialReaderReplay(const std::vector<uint8_t>& data)
+      : mData(data), mPos(0), mEnd(data.size()), mMillis(0) {}
+
+  /**
+   * @brief Restart the replay at the first byte and make the whole MIDI byte stream available.
+   *
+   */
+  void rewind() {
+    mPos = 0;
+    mEnd = mData.size();
+  }
+
+  /**
+   * @brief Make only the next bytes of the MIDI byte stream available.
+   *
+   * @param[in] count the number of bytes to make available, the remaining bytes are held back
+   */
+  void release(const size_t count) { mEnd = std::min(mPos + count, mData.size()); }
+
+  void begin() override {}
+
+  int available() override { return (int)(mEnd - mPos); }
+
+  int read() override { return (mPos < mEnd) ? mData[mPos++] : -1; }
+
+  size_t readBytes(uint8_t* dst, const size_t max) override {
+    const size_t count = std::min(max, mEnd - mPos);
+
+    std::memcpy(dst, mData.data() + mPos, count);
+    mPos += count;
+
+    return count;
+  }
+
+  void sleep(uint16_t) override {}
+
+  uint32_t millis() override { return mMillis++; }
+
+ private:
+  const std::vector<uint8_t> mData; /**< the MIDI byte stream to replay */
+  size_t mPos;                      /**< the position of the next byte to replay */
+  size_t mEnd;                      /**< the position of the first byte held back */
+  uint32_t mMillis;                 /**< the simulated time, advanced by each millis() call */
+};
+
+/**
+ * @brief Create a synthetic MIDI byte stream of MIDI CC messages.
+ *
+ * The controllers and values cycle through the range [0, 127] with different strides, i.e.
+ * subsequent messages address different DMX channels with changing values. Controllers repeated
+ * within the stream get another value, so replaying the stream again still changes DMX values.
+ *
+ * @param[in] messages the number of MIDI CC messages
+ * @param[in] channel the MIDI channel in the range [1, 16]
+ * @param[in] runningStatus true to send the status byte only once
+ * @return std::vector<uint8_t> - the MIDI byte stream
+ */
+inline std::vector<uint8_t> syntheticStream(const size_t messages, const uint8_t channel,
+                                            const bool runningStatus) {
+  std::vector<uint8_t> stream;
+
+  for (size_t msg = 0; msg < messages; msg++) {
+    if (!runningStatus || (0 == msg)) {
+      stream.push_back((uint8_t)(0xb0 | ((channel - 1) & 0x0f)));
+    }
+
+    stream.push_back((uint8_t)((msg * 5) & 0x7f));
+    stream.push_back((uint8_t)(((msg * 3 + 1) ^ ((msg >> 7) << 6)) & 0x7f));
+  }
+
+  return stream;
+}
+}  // namespace mididmxbridge::benchmarks
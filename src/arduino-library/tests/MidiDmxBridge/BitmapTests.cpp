@@ -0,0 +1,103 @@
+/**
+ * @file BitmapTests.cpp
+ * @author Christian Neukam
+ * @brief Unit Tests for the mididmxbridge::Bitmap class template.
+ * @version 1.0
+ * @date 2024-02-17
+ *
+ * @copyright Copyright 2024 Christian Neukam. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "Bitmap.h"
+
+namespace mididmxbridge::unittest {
+using mididmxbridge::Bitmap;
+
+/**
+ * @brief This test case tests whether a default constructed mididmxbridge::Bitmap has no bit set
+ * and occupies one bit per position.
+ *
+ */
+TEST(BitmapTestSuite, construct_empty) {
+  Bitmap<128> bitmap;
+
+  EXPECT_FALSE(bitmap.any());
+  EXPECT_EQ(bitmap.size(), 128);
+  EXPECT_EQ(sizeof(bitmap), 16u);
+  EXPECT_EQ(bitmap.next(0), 128);
+}
+
+/**
+ * @brief This test case tests whether the bits of a mididmxbridge::Bitmap can be set, tested and
+ * cleared individually.
+ *
+ */
+TEST(BitmapTestSuite, set_test_reset) {
+  Bitmap<20> bitmap;
+
+  bitmap.set(0);
+  bitmap.set(9);
+  bitmap.set(19);
+
+  EXPECT_TRUE(bitmap.any());
+  EXPECT_TRUE(bitmap.test(0));
+  EXPECT_FALSE(bitmap.test(1));
+  EXPECT_TRUE(bitmap.test(9));
+  EXPECT_TRUE(bitmap.test(19));
+
+  bitmap.reset(9);
+  EXPECT_FALSE(bitmap.test(9));
+
+  bitmap.clear();
+  EXPECT_FALSE(bitmap.any());
+}
+
+/**
+ * @brief This test case tests whether positions outside the range of a mididmxbridge::Bitmap are
+ * ignored.
+ *
+ */
+TEST(BitmapTestSuite, out_of_range_is_ignored) {
+  Bitmap<20> bitmap;
+
+  bitmap.set(20);
+  bitmap.set(255);
+
+  EXPECT_FALSE(bitmap.any());
+  EXPECT_FALSE(bitmap.test(20));
+}
+
+/**
+ * @brief This test case tests whether mididmxbridge::Bitmap::next() iterates all set bits in
+ * ascending order.
+ *
+ */
+TEST(BitmapTestSuite, next_iterates_set_bits) {
+  Bitmap<128> bitmap;
+  std::vector<uint16_t> positions;
+
+  bitmap.set(3);
+  bitmap.set(64);
+  bitmap.set(127);
+
+  for (uint16_t pos = bitmap.next(0); pos < bitmap.size(); pos = bitmap.next(pos + 1)) {
+    positions.push_back(pos);
+  }
+
+  EXPECT_THAT(positions, testing::ElementsAre(3, 64, 127));
+}
+}  // namespace mididmxbridge::unittest
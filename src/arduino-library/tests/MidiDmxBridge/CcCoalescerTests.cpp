@@ -0,0 +1,85 @@
+/**
+ * @file CcCoalescerTests.cpp
+ * @author Christian Neukam
+ * @brief Unit tests of the MIDI CC coalescing of the MidiDmxBridge library.
+ * @version 1.0
+ * @date 2024-03-11
+ *
+ * @copyright Copyright 2024 Christian Neukam. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "CcCoalescer.h"
+
+namespace mididmxbridge::unittest {
+using mididmxbridge::midi::CcCoalescer;
+
+/**
+ * @brief This test case tests whether a default constructed mididmxbridge::midi::CcCoalescer is
+ * empty.
+ *
+ */
+TEST(CcCoalescerTestSuite, construct_empty) {
+  CcCoalescer dut;
+
+  EXPECT_TRUE(dut.empty());
+  EXPECT_EQ(dut.size(), 0);
+}
+
+/**
+ * @brief This test case tests whether mididmxbridge::midi::CcCoalescer::add() keeps only the last
+ * value per MIDI channel and controller in the order of the first occurrence.
+ *
+ */
+TEST(CcCoalescerTestSuite, add_shall_keep_last_value) {
+  CcCoalescer dut;
+
+  EXPECT_TRUE(dut.add(7, 10, 1));
+  EXPECT_TRUE(dut.add(8, 20, 1));
+  EXPECT_TRUE(dut.add(7, 30, 2));
+  EXPECT_TRUE(dut.add(7, 40, 1));
+
+  ASSERT_EQ(dut.size(), 3);
+  EXPECT_EQ(dut[0].controller, 7);
+  EXPECT_EQ(dut[0].value, 40);
+  EXPECT_EQ(dut[0].midiChannel, 1);
+  EXPECT_EQ(dut[1].controller, 8);
+  EXPECT_EQ(dut[1].value, 20);
+  EXPECT_EQ(dut[2].value, 30);
+  EXPECT_EQ(dut[2].midiChannel, 2);
+
+  dut.clear();
+  EXPECT_TRUE(dut.empty());
+}
+
+/**
+ * @brief This test case tests whether mididmxbridge::midi::CcCoalescer::add() rejects new
+ * controllers once the table is full, while known controllers are still merged.
+ *
+ */
+TEST(CcCoalescerTestSuite, add_full_shall_fail) {
+  CcCoalescer dut;
+
+  for (uint8_t idx = 0; idx < kCoalesceSize; idx++) {
+    EXPECT_TRUE(dut.add(idx, idx, 1));
+  }
+
+  EXPECT_FALSE(dut.add(kCoalesceSize, 0, 1));
+  EXPECT_TRUE(dut.add(0, 99, 1));
+  EXPECT_EQ(dut.size(), kCoalesceSize);
+  EXPECT_EQ(dut[0].value, 99);
+}
+}  // namespace mididmxbridge::unittest
@@ -120,4 +120,21 @@ TEST_P(MidiCcInputRangeTestSuite, toDmx_scalesDmxValue_shall_pass) {
 
   EXPECT_THAT(dut.toDmx(), EQ(DmxValue{dmxChannel, dmxValue}));
 }
+
+/**
+ * @brief This test case checks whether the function
+ * mididmxbridge::midi::ContinuousController::toDmx16() maps the 14-bit MIDI range onto the full
+ * 16-bit DMX range.
+ *
+ */
+TEST(MidiCcTestSuite, toDmx16_covers_full_range) {
+  EXPECT_EQ(ContinuousController::toDmx16(0x0000), 0x0000);
+  EXPECT_EQ(ContinuousController::toDmx16(0x2000), 0x8002);
+  EXPECT_EQ(ContinuousController::toDmx16(0x3fff), 0xffff);
+  EXPECT_EQ(ContinuousController::toDmx16(0xffff), 0xffff);
+
+  for (uint16_t value = 1; value <= 0x3fff; value++) {
+    ASSERT_GT(ContinuousController::toDmx16(value), ContinuousController::toDmx16(value - 1));
+  }
+}
 }  // namespace mididmxbridge::unittest
@@ -0,0 +1,84 @@
+/**
+ * @file DenseSceneTests.cpp
+ * @author Christian Neukam
+ * @brief Unit Tests for the mididmxbridge::dmx::DenseScene class template.
+ * @version 1.0
+ * @date 2024-02-24
+ *
+ * @copyright Copyright 2024 Christian Neukam. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "DenseScene.h"
+
+namespace mididmxbridge::unittest {
+using mididmxbridge::dmx::DenseScene;
+
+/**
+ * @brief This test case tests whether a default constructed mididmxbridge::dmx::DenseScene is
+ * empty and only occupies one byte plus one bit per channel.
+ *
+ */
+TEST(DenseSceneTestSuite, construct_empty) {
+  DenseScene<128> scene;
+
+  EXPECT_EQ(scene.size(), 128);
+  EXPECT_EQ(sizeof(scene), 128u + 16u);
+  EXPECT_EQ(scene.next(0), scene.size());
+  EXPECT_FALSE(scene.isSet(0));
+  EXPECT_EQ(scene.value(0), 0);
+}
+
+/**
+ * @brief This test case tests whether mididmxbridge::dmx::DenseScene::set() reports a change only
+ * if the channel is new to the scene or its value differs.
+ *
+ */
+TEST(DenseSceneTestSuite, set_reports_changes) {
+  DenseScene<128> scene;
+
+  EXPECT_TRUE(scene.set(127, 0));
+  EXPECT_FALSE(scene.set(127, 0));
+  EXPECT_TRUE(scene.set(127, 42));
+  EXPECT_FALSE(scene.set(128, 42));
+
+  EXPECT_TRUE(scene.isSet(127));
+  EXPECT_EQ(scene.value(127), 42);
+  EXPECT_EQ(scene.value(128), 0);
+}
+
+/**
+ * @brief This test case tests whether mididmxbridge::dmx::DenseScene::next() iterates all channels
+ * of the scene and mididmxbridge::dmx::DenseScene::clear() removes them.
+ *
+ */
+TEST(DenseSceneTestSuite, next_and_clear) {
+  DenseScene<128> scene;
+  std::vector<uint16_t> channels;
+
+  scene.set(1, 10);
+  scene.set(100, 20);
+
+  for (uint16_t ch = scene.next(0); ch < scene.size(); ch = scene.next(ch + 1)) {
+    channels.push_back(ch);
+  }
+  EXPECT_THAT(channels, testing::ElementsAre(1, 100));
+
+  scene.clear();
+  EXPECT_EQ(scene.next(0), scene.size());
+  EXPECT_EQ(scene.value(100), 0);
+}
+}  // namespace mididmxbridge::unittest
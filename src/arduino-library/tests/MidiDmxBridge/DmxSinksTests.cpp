@@ -0,0 +1,144 @@
+/**
+ * @file DmxSinksTests.cpp
+ * @author Christian Neukam
+ * @brief Unit Tests for the mididmxbridge::dmx::DmxSinks class
+ * @version 1.0
+ * @date 2024-03-16
+ *
+ * @copyright Copyright 2024 Christian Neukam. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "DmxSinks.h"
+
+namespace mididmxbridge::unittest {
+using namespace mididmxbridge::dmx;
+
+using testing::MockFunction;
+using testing::StrictMock;
+
+/**
+ * @brief This class provides the fixture for the Test Suite, which checks the DmxSinks class.
+ *
+ */
+class DmxSinksTestSuite : public testing::Test {
+ public:
+  /**
+   * @brief Construct a new DmxSinksTestSuite object.
+   *
+   */
+  DmxSinksTestSuite() : mFrame(), mDut() {
+    for (uint16_t ch = 0; ch <= kMaxDmxChannel; ch++) {
+      mFrame[ch] = (uint8_t)ch;
+    }
+  }
+
+ protected:
+  uint8_t mFrame[kMaxDmxChannel + 1]; /**< the shared frame buffer */
+  DmxSinks mDut;                      /**< the device under test */
+};
+
+/**
+ * @brief This test case checks whether invalid callbacks and sinks exceeding the capacity are
+ * rejected.
+ *
+ */
+TEST_F(DmxSinksTestSuite, add_rejects_invalid_and_excess_sinks) {
+  MockFunction<void(const uint8_t*, const uint16_t, const uint16_t)> sink;
+
+  EXPECT_FALSE(mDut.add(nullptr, 0));
+  for (uint8_t idx = 0; idx < kMaxSinks; idx++) {
+    EXPECT_TRUE(mDut.add(sink.AsStdFunction(), 0));
+  }
+  EXPECT_FALSE(mDut.add(sink.AsStdFunction(), 0));
+  EXPECT_EQ(mDut.size(), kMaxSinks);
+
+  mDut.clear();
+  EXPECT_EQ(mDut.size(), 0);
+  EXPECT_FALSE(mDut.service(mFrame, 0));
+}
+
+/**
+ * @brief This test case checks whether the sink reads the shared frame buffer without a copy, the
+ * whole frame first and afterwards only the span of the changed channels.
+ *
+ */
+TEST_F(DmxSinksTestSuite, service_writes_changed_span_of_shared_frame) {
+  StrictMock<MockFunction<void(const uint8_t*, const uint16_t, const uint16_t)>> sink;
+  testing::InSequence seq;
+
+  EXPECT_CALL(sink, Call(&mFrame[0], 0, kMaxDmxChannel + 1));
+  EXPECT_CALL(sink, Call(&mFrame[5], 5, 5));
+
+  mDut.add(sink.AsStdFunction(), 0);
+  EXPECT_TRUE(mDut.service(mFrame, 0));
+  EXPECT_FALSE(mDut.service(mFrame, 1));
+
+  mDut.markChanged(9);
+  mDut.markChanged(5);
+  EXPECT_TRUE(mDut.service(mFrame, 2));
+  EXPECT_FALSE(mDut.service(mFrame, 3));
+}
+
+/**
+ * @brief This test case checks whether every sink is written at its own rate and a slow sink
+ * receives the merged changes of its interval.
+ *
+ */
+TEST_F(DmxSinksTestSuite, service_writes_sinks_at_their_own_rate) {
+  StrictMock<MockFunction<void(const uint8_t*, const uint16_t, const uint16_t)>> fast;
+  StrictMock<MockFunction<void(const uint8_t*, const uint16_t, const uint16_t)>> slow;
+
+  EXPECT_CALL(fast, Call(&mFrame[0], 0, kMaxDmxChannel + 1));
+  EXPECT_CALL(slow, Call(&mFrame[0], 0, kMaxDmxChannel + 1));
+  EXPECT_CALL(fast, Call(&mFrame[1], 1, 1));
+  EXPECT_CALL(fast, Call(&mFrame[2], 2, 1));
+  EXPECT_CALL(slow, Call(&mFrame[1], 1, 2));
+
+  mDut.add(fast.AsStdFunction(), 0);
+  mDut.add(slow.AsStdFunction(), 100);
+  mDut.service(mFrame, 0);
+  mDut.service(mFrame, 0);
+
+  mDut.markChanged(1);
+  EXPECT_TRUE(mDut.service(mFrame, 10));
+  EXPECT_FALSE(mDut.service(mFrame, 10));
+  mDut.markChanged(2);
+  EXPECT_TRUE(mDut.service(mFrame, 20));
+  EXPECT_FALSE(mDut.service(mFrame, 99));
+  EXPECT_TRUE(mDut.service(mFrame, 100));
+}
+
+/**
+ * @brief This test case checks whether at most one sink is written per call in round-robin
+ * order.
+ *
+ */
+TEST_F(DmxSinksTestSuite, service_writes_one_sink_per_call) {
+  std::vector<int> order;
+
+  mDut.add([&order](const uint8_t*, const uint16_t, const uint16_t) { order.push_back(0); }, 0);
+  mDut.add([&order](const uint8_t*, const uint16_t, const uint16_t) { order.push_back(1); }, 0);
+
+  for (uint8_t round = 0; round < 3; round++) {
+    mDut.markChanged(round);
+    EXPECT_TRUE(mDut.service(mFrame, round));
+    EXPECT_TRUE(mDut.service(mFrame, round));
+  }
+
+  EXPECT_EQ(order, std::vector<int>({0, 1, 0, 1, 0, 1}));
+}
+}  // namespace mididmxbridge::unittest
@@ -25,6 +25,8 @@
 #include <functional>
 
 #include "Dmx.h"
+#include "ResponseCurve.h"
+#include "SceneStoreFake.h"
 
 namespace mididmxbridge::unittest {
 using namespace mididmxbridge::dmx;
@@ -58,7 +60,7 @@ class DmxTestSuite : public testing::Test {
    * @brief Mock method for mididmxbridge::dmx::DmxOnChangeCallback.
    *
    */
-  MOCK_METHOD(void, onChangeCallback, (const uint8_t channel, const uint8_t value), ());
+  MOCK_METHOD(void, onChangeCallback, (const uint16_t channel, const uint8_t value), ());
 
  protected:
   const DmxRgb mDmxRgb = {21, 42, 63}; /**< the static RGB scene to use */
@@ -67,8 +69,9 @@ class DmxTestSuite : public testing::Test {
 };
 
 class DmxValueTestSuite : public DmxTestSuite,
-                          public testing::WithParamInterface<std::tuple<uint8_t, uint8_t>> {};
-class MidiCcValueTestSuite : public DmxValueTestSuite {};
+                          public testing::WithParamInterface<std::tuple<uint16_t, uint8_t>> {};
+class MidiCcValueTestSuite : public DmxTestSuite,
+                             public testing::WithParamInterface<std::tuple<uint8_t, uint8_t>> {};
 class DmxGainTestSuite : public DmxTestSuite, public testing::WithParamInterface<uint16_t> {};
 class DmxGainOutsideDeadZoneTestSuite : public DmxGainTestSuite {};
 class DmxGainInsideDeadZoneTestSuite : public DmxGainTestSuite {};
@@ -84,8 +87,8 @@ class DmxGainInsideDeadZoneTestSuite : public DmxGainTestSuite {};
  * | -------------- | ----------- |
  * | (-inf, 0)      | not required -> input range is unsigned |
  * | [0, 1]         | lower boundary, valid input |
- * | [126, 127]     | upper boundary, valid input |
- * | [128, 255]     | upper boundary, invalid input, gets clipped to 127 |
+ * | [kMaxDmxChannel - 1, kMaxDmxChannel] | upper boundary, valid input |
+ * | [kMaxDmxChannel + 1, 1023] | upper boundary, invalid input, gets ignored |
  *
  * | value range  | description |
  * | -------------- | ----------- |
@@ -96,8 +99,8 @@ class DmxGainInsideDeadZoneTestSuite : public DmxGainTestSuite {};
  * @see DmxValueTestSuite
  */
 INSTANTIATE_TEST_SUITE_P(DMX, DmxValueTestSuite,
-                         testing::Combine(testing::Values(0, 1, kMidiMaxValue - 1, kMidiMaxValue,
-                                                          kMidiMaxValue + 1, 254, 255),
+                         testing::Combine(testing::Values(0, 1, kMaxDmxChannel - 1, kMaxDmxChannel,
+                                                          kMaxDmxChannel + 1, 1023),
                                           testing::Values(0, 1, 254, 255)),
                          [](const testing::TestParamInfo<DmxValueTestSuite::ParamType>& info) {
                            std::string name = std::to_string(std::get<0>(info.param)) + "_" +
@@ -240,7 +243,7 @@ TEST_F(DmxTestSuite, setDmxValue_invalid_doesNot_triggers_callback) {
 TEST_P(DmxValueTestSuite, setDmxValue_valid_triggers_callback) {
   const auto [channel, value] = GetParam();
 
-  if (channel <= kMidiMaxValue) {
+  if (channel <= kMaxDmxChannel) {
     EXPECT_CALL(*this, onChangeCallback(channel, value)).Times(1);
   } else {
     EXPECT_CALL(*this, onChangeCallback(channel, value)).Times(0);
@@ -337,6 +340,30 @@ TEST_P(DmxGainInsideDeadZoneTestSuite, setGain_inside_deadZone_dont_triggers_cal
   mDut.setGain(gain);
 }
 
+/**
+ * @brief This test case checks whether the mididmxbridge::dmx::Dmx::setGain() function scales all
+ * possible DMX values exactly like the arithmetic gain, independent of the gain lookup table.
+ *
+ */
+TEST_P(DmxGainTestSuite, setGain_scales_all_values_exactly) {
+  const uint16_t gain = std::min(GetParam(), kGainMaxValue);
+  std::vector<uint8_t> expected;
+  std::vector<uint8_t> actual;
+
+  ON_CALL(*this, onChangeCallback(_, _)).WillByDefault([&](const uint8_t, const uint8_t value) {
+    actual.push_back(value);
+  });
+
+  mDut.setGain((gain < kGainMaxValue / 2) ? kGainMaxValue : 0);  // leave the dead zone of gain
+  mDut.setGain(gain);
+  for (uint16_t value = 0; value <= 255; value++) {
+    expected.push_back((value * gain) / kGainMaxValue);
+    mDut.setDmxValue({(uint8_t)(value % 2), (uint8_t)value});
+  }
+
+  EXPECT_EQ(actual, expected);
+}
+
 /**
  * @brief This test case checks whether activating the static scene calls the corresponding
  * mididmxbridge::dmx::DmxOnChangeCallback callbacks.
@@ -396,24 +423,759 @@ TEST_F(DmxTestSuite, activateDynamicScene_triggers_callback_with_dynamic_scene)
 }
 
 /**
- * @brief This test case checks whether a blackout is executed on the static scene when the dynamic
- * scene is activated.
+ * @brief This test case checks whether the channels of the static scene missing in the dynamic
+ * scene are turned off when the dynamic scene is activated.
  *
  */
 TEST_F(DmxTestSuite, activateDynamicScene_triggers_blackout_for_static_scene) {
   testing::InSequence s;
 
+  EXPECT_CALL(*this, onChangeCallback(mDmxRgbChannels.red[0], mDmxRgb.red));
+  EXPECT_CALL(*this, onChangeCallback(mDmxRgbChannels.green[0], mDmxRgb.green));
+  EXPECT_CALL(*this, onChangeCallback(mDmxRgbChannels.blue[0], mDmxRgb.blue));
+  EXPECT_CALL(*this, onChangeCallback(1, 42));
+  EXPECT_CALL(*this, onChangeCallback(mDmxRgbChannels.green[0], 0));
+  EXPECT_CALL(*this, onChangeCallback(mDmxRgbChannels.blue[0], 0));
+
+  mDut.setStaticScene(mDmxRgbChannels, mDmxRgb);
+  mDut.activateStaticScene();
+  mDut.setDmxValue({1, 42});
+  mDut.activateDynamicScene();
+}
+#if MIDIDMXBRIDGE_USE_FRAME_MODE
+/**
+ * @brief This test case checks whether the frame-based mode defers the
+ * mididmxbridge::dmx::DmxOnChangeCallback callbacks until mididmxbridge::dmx::Dmx::flush() and
+ * coalesces several changes of the same channel to a single callback.
+ *
+ */
+TEST_F(DmxTestSuite, frameMode_flush_coalesces_changes) {
+  testing::InSequence s;
+
+  EXPECT_CALL(*this, onChangeCallback(1, 44));
+  EXPECT_CALL(*this, onChangeCallback(2, 10));
+
+  mDut.setFrameMode(true);
+  mDut.setDmxValue({1, 42});
+  mDut.setDmxValue({2, 10});
+  mDut.setDmxValue({1, 43});
+  mDut.setDmxValue({1, 44});
+  mDut.flush();
+  mDut.flush();
+}
+
+/**
+ * @brief This test case checks whether the frame-based mode resolves a scene switch to the final
+ * value of each affected channel.
+ *
+ */
+TEST_F(DmxTestSuite, frameMode_sceneSwitch_sends_final_values) {
   EXPECT_CALL(*this, onChangeCallback(mDmxRgbChannels.red[0], mDmxRgb.red));
   EXPECT_CALL(*this, onChangeCallback(mDmxRgbChannels.green[0], mDmxRgb.green));
   EXPECT_CALL(*this, onChangeCallback(mDmxRgbChannels.blue[0], mDmxRgb.blue));
   EXPECT_CALL(*this, onChangeCallback(mDmxRgbChannels.red[0], 0));
   EXPECT_CALL(*this, onChangeCallback(mDmxRgbChannels.green[0], 0));
   EXPECT_CALL(*this, onChangeCallback(mDmxRgbChannels.blue[0], 0));
-  EXPECT_CALL(*this, onChangeCallback(1, 42));
+  EXPECT_CALL(*this, onChangeCallback(5, 42));
 
   mDut.setStaticScene(mDmxRgbChannels, mDmxRgb);
   mDut.activateStaticScene();
+  mDut.setFrameMode(true);
+  mDut.setDmxValue({5, 42});
+  mDut.activateDynamicScene();
+  mDut.flush();
+}
+
+/**
+ * @brief This test case checks whether disabling the frame-based mode flushes the pending changes.
+ *
+ */
+TEST_F(DmxTestSuite, frameMode_disable_flushes_changes) {
+  EXPECT_CALL(*this, onChangeCallback(1, 42));
+
+  mDut.setFrameMode(true);
   mDut.setDmxValue({1, 42});
+  mDut.setFrameMode(false);
+}
+
+/**
+ * @brief This test case checks whether a registered mididmxbridge::DmxOnFrameCallback receives all
+ * changed channels as one contiguous span instead of single mididmxbridge::DmxOnChangeCallback
+ * callbacks.
+ *
+ */
+TEST_F(DmxTestSuite, frameCallback_receives_contiguous_span) {
+  testing::MockFunction<void(const uint8_t*, const uint16_t, const uint16_t)> frameCallback;
+  std::vector<uint8_t> span;
+
+  EXPECT_CALL(*this, onChangeCallback(_, _)).Times(0);
+  EXPECT_CALL(frameCallback, Call(_, 3, 1));
+  EXPECT_CALL(frameCallback, Call(_, 2, 4))
+      .WillOnce([&](const uint8_t* values, const uint16_t, const uint16_t count) {
+        span.assign(values, values + count);
+      });
+
+  mDut.setFrameCallback(frameCallback.AsStdFunction());
+  mDut.setDmxValue({3, 30});
+  mDut.flush();
+  mDut.setDmxValue({5, 50});
+  mDut.setDmxValue({2, 20});
+  mDut.flush();
+
+  EXPECT_THAT(span, testing::ElementsAre(20, 30, 0, 50));
+}
+#endif
+
+#if MIDIDMXBRIDGE_USE_SINKS
+/**
+ * @brief This test case checks whether a sink reads the scaled DMX values of the immediate output
+ * from the shared frame buffer, in addition to the DmxOnChangeCallback callback.
+ *
+ */
+TEST_F(DmxTestSuite, addSink_mirrors_scaled_output) {
+  testing::MockFunction<void(const uint8_t*, const uint16_t, const uint16_t)> sink;
+  std::vector<uint8_t> span;
+
+  EXPECT_CALL(*this, onChangeCallback(_, _)).Times(3);
+  EXPECT_CALL(sink, Call(_, 0, kMaxDmxChannel + 1));
+  EXPECT_CALL(sink, Call(_, 2, 3))
+      .WillOnce([&](const uint8_t* values, const uint16_t, const uint16_t count) {
+        span.assign(values, values + count);
+      });
+
+  EXPECT_TRUE(mDut.addSink(sink.AsStdFunction(), 0));
+  mDut.serviceSinks(0);
+  mDut.setGain(kUnityGainValue / 2);
+  mDut.setDmxValue({4, 40});
+  mDut.setDmxValue({2, 20});
+  mDut.setDmxValue({2, 20});
+  mDut.setDmxValue({3, 0});
+  mDut.serviceSinks(1);
+  mDut.serviceSinks(2);
+
+  EXPECT_THAT(span, testing::ElementsAre(10, 0, 20));
+}
+#endif
+
+/**
+ * @brief This test case checks whether a patched MIDI CC controller is output on all DMX addresses
+ * it is patched to, while unpatched controllers are ignored.
+ *
+ */
+TEST_F(DmxTestSuite, patch_maps_midi_cc_to_dmx_addresses) {
+  EXPECT_CALL(*this, onChangeCallback(kMaxDmxChannel, 20));
+  EXPECT_CALL(*this, onChangeCallback(5, 20));
+
+  EXPECT_TRUE(mDut.patch(1, kMaxDmxChannel));
+  EXPECT_TRUE(mDut.patch(1, 5));
+  mDut.setMidiCcValue(1, 10);
+  mDut.setMidiCcValue(2, 10);
+}
+
+/**
+ * @brief This test case checks whether a patch restricted to a MIDI channel only applies to MIDI CC
+ * values received on that MIDI channel.
+ *
+ */
+TEST_F(DmxTestSuite, patch_filters_midi_channel) {
+  EXPECT_CALL(*this, onChangeCallback(100, 20));
+
+  EXPECT_TRUE(mDut.patch(1, 100, 2));
+  mDut.setMidiCcValue(1, 10, 1);
+  mDut.setMidiCcValue(1, 10, 2);
+}
+
+/**
+ * @brief This test case checks whether the MIDI CC controller is used as DMX channel again once all
+ * patches got removed.
+ *
+ */
+TEST_F(DmxTestSuite, clearPatches_restores_identity_mapping) {
+  EXPECT_CALL(*this, onChangeCallback(1, 20));
+
+  EXPECT_TRUE(mDut.patch(1, 100));
+  mDut.clearPatches();
+  mDut.setMidiCcValue(1, 10);
+}
+
+/**
+ * @brief This test case checks whether the DMX channel offset of a MIDI channel is applied to the
+ * MIDI CC values received on that MIDI channel only.
+ *
+ */
+TEST_F(DmxTestSuite, setChannelOffset_shifts_midi_channel) {
+  EXPECT_CALL(*this, onChangeCallback(1, 20));
+  EXPECT_CALL(*this, onChangeCallback(65, 20));
+
+  EXPECT_TRUE(mDut.setChannelOffset(2, 64));
+  EXPECT_FALSE(mDut.setChannelOffset(0, 64));
+  EXPECT_FALSE(mDut.setChannelOffset(17, 64));
+  EXPECT_FALSE(mDut.setChannelOffset(3, kMaxDmxChannel + 1));
+  mDut.setMidiCcValue(1, 10, 1);
+  mDut.setMidiCcValue(1, 10, 2);
+}
+
+#if MIDIDMXBRIDGE_USE_HIGH_RES
+/**
+ * @brief This test case checks whether 14-bit MIDI CC pairs are output with the full 8-bit DMX
+ * range if mididmxbridge::DmxResolution::k8Bit is set, while other controllers stay 7-bit.
+ *
+ */
+TEST_F(DmxTestSuite, setResolution_8bit_outputs_full_range) {
+  testing::InSequence seq;
+
+  EXPECT_CALL(*this, onChangeCallback(1, 0xfe));
+  EXPECT_CALL(*this, onChangeCallback(1, 0xff));
+  EXPECT_CALL(*this, onChangeCallback(64, 0x20));
+
+  mDut.setResolution(DmxResolution::k8Bit);
+  mDut.setMidiCcValue(1, 0x7f);
+  mDut.setMidiCcValue(33, 0x7f);
+  mDut.setMidiCcValue(64, 0x10);
+}
+
+/**
+ * @brief This test case checks whether NRPN values are output as coarse and fine DMX channel pair
+ * on the NRPN parameter if mididmxbridge::DmxResolution::k16Bit is set.
+ *
+ */
+TEST_F(DmxTestSuite, setResolution_16bit_outputs_nrpn_pair) {
+  testing::InSequence seq;
+
+  EXPECT_CALL(*this, onChangeCallback(100, 0x80));
+  EXPECT_CALL(*this, onChangeCallback(101, 0x02));
+  EXPECT_CALL(*this, onChangeCallback(100, 0x81));
+  EXPECT_CALL(*this, onChangeCallback(101, 0xfe));
+
+  mDut.setResolution(DmxResolution::k16Bit);
+  mDut.setMidiCcValue(99, 0x00);
+  mDut.setMidiCcValue(98, 100);
+  mDut.setMidiCcValue(6, 0x40);
+  mDut.setMidiCcValue(38, 0x7f);
+}
+
+/**
+ * @brief This test case checks whether the data entry of an RPN produces no output, i.e. it drives
+ * neither the DMX channel 6 nor 38.
+ *
+ */
+TEST_F(DmxTestSuite, setResolution_16bit_drops_rpn_data_entry) {
+  EXPECT_CALL(*this, onChangeCallback(_, _)).Times(0);
+
+  mDut.setResolution(DmxResolution::k16Bit);
+  mDut.setMidiCcValue(101, 0x00);
+  mDut.setMidiCcValue(100, 0x00);
+  mDut.setMidiCcValue(6, 0x02);
+  mDut.setMidiCcValue(38, 0x00);
+}
+#endif
+
+/**
+ * @brief This test case checks whether a crossfade interpolates the channels of both scenes over
+ * the fade time and ends with the exact values of the new scene.
+ *
+ */
+TEST_F(DmxTestSuite, fade_interpolates_between_scenes) {
+  testing::InSequence seq;
+
+  EXPECT_CALL(*this, onChangeCallback(1, 100));
+  EXPECT_CALL(*this, onChangeCallback(1, 100));
+  EXPECT_CALL(*this, onChangeCallback(2, 0));
+  EXPECT_CALL(*this, onChangeCallback(3, 0));
+  EXPECT_CALL(*this, onChangeCallback(1, 60));
+  EXPECT_CALL(*this, onChangeCallback(2, 21));
+  EXPECT_CALL(*this, onChangeCallback(3, 31));
+  EXPECT_CALL(*this, onChangeCallback(1, mDmxRgb.red));
+  EXPECT_CALL(*this, onChangeCallback(2, mDmxRgb.green));
+  EXPECT_CALL(*this, onChangeCallback(3, mDmxRgb.blue));
+
+  mDut.setDmxValue({1, 100});
+  mDut.setStaticScene(mDmxRgbChannels, mDmxRgb);
+  mDut.setFadeTime(100);
+  mDut.activateStaticScene();
+  EXPECT_TRUE(mDut.isFading());
+
+  mDut.fade(1000);  // the fade time starts with the first call
+  mDut.fade(1050);
+  mDut.fade(1100);
+  EXPECT_FALSE(mDut.isFading());
+
+  mDut.fade(1200);
+}
+
+/**
+ * @brief This test case checks whether a crossfade outputs no more channels per
+ * mididmxbridge::dmx::Dmx::fade() call than set via mididmxbridge::dmx::Dmx::setFadeBudget().
+ *
+ */
+TEST_F(DmxTestSuite, fade_respects_budget) {
+  testing::InSequence seq;
+
+  EXPECT_CALL(*this, onChangeCallback(1, 0));
+  EXPECT_CALL(*this, onChangeCallback(2, 0));
+  EXPECT_CALL(*this, onChangeCallback(3, mDmxRgb.blue));
+  EXPECT_CALL(*this, onChangeCallback(1, mDmxRgb.red));
+  EXPECT_CALL(*this, onChangeCallback(2, mDmxRgb.green));
+  EXPECT_CALL(*this, onChangeCallback(3, mDmxRgb.blue));
+
+  mDut.setStaticScene(mDmxRgbChannels, mDmxRgb);
+  mDut.setFadeTime(100);
+  mDut.setFadeBudget(2);
+  mDut.activateStaticScene();
+
+  mDut.fade(0);
+  mDut.fade(100);  // the sweep started at level 0 is completed first
+  EXPECT_TRUE(mDut.isFading());
+  mDut.fade(100);
+  mDut.fade(100);
+  EXPECT_FALSE(mDut.isFading());
+}
+
+/**
+ * @brief This test case checks whether switching back during a crossfade reverses it from the
+ * current mix instead of jumping.
+ *
+ */
+TEST_F(DmxTestSuite, fade_reverses_from_current_mix) {
+  testing::InSequence seq;
+
+  EXPECT_CALL(*this, onChangeCallback(1, 0));
+  EXPECT_CALL(*this, onChangeCallback(1, 16));
+  EXPECT_CALL(*this, onChangeCallback(1, 9));
+  EXPECT_CALL(*this, onChangeCallback(1, 0));
+
+  mDmxRgbChannels.green.pop_back();
+  mDmxRgbChannels.blue.pop_back();
+  mDut.setStaticScene(mDmxRgbChannels, {64, 0, 0});
+  mDut.setFadeTime(100);
+  mDut.activateStaticScene();
+  mDut.fade(0);
+  mDut.fade(25);
+  mDut.activateDynamicScene();
+  mDut.fade(35);
+  mDut.fade(100);
+  EXPECT_FALSE(mDut.isFading());
+}
+
+/**
+ * @brief This test case checks whether a gain change outputs the active scene incrementally via
+ * mididmxbridge::dmx::Dmx::refresh() if a refresh budget is set.
+ *
+ */
+TEST_F(DmxTestSuite, setGain_refreshes_incrementally) {
+  testing::InSequence seq;
+
+  EXPECT_CALL(*this, onChangeCallback(1, 10));
+  EXPECT_CALL(*this, onChangeCallback(2, 20));
+  EXPECT_CALL(*this, onChangeCallback(3, 30));
+  EXPECT_CALL(*this, onChangeCallback(1, 5));
+  EXPECT_CALL(*this, onChangeCallback(2, 10));
+  EXPECT_CALL(*this, onChangeCallback(3, 15));
+
+  mDut.setDmxValue({1, 10});
+  mDut.setDmxValue({2, 20});
+  mDut.setDmxValue({3, 30});
+  mDut.setRefreshBudget(2);
+  EXPECT_EQ(mDut.refreshProgress(), 100);
+
+  mDut.setGain(kUnityGainValue / 2);
+  EXPECT_TRUE(mDut.isRefreshing());
+  mDut.refresh();
+  EXPECT_EQ(mDut.refreshProgress(), 3 * 100 / (kMaxDmxChannel + 1));
+  mDut.refresh();
+  mDut.refresh();
+  EXPECT_FALSE(mDut.isRefreshing());
+  EXPECT_EQ(mDut.refreshProgress(), 100);
+}
+
+/**
+ * @brief This test case checks whether a gain change during a running refresh repeats the refresh,
+ * so that the channels already refreshed get the latest gain as well.
+ *
+ */
+TEST_F(DmxTestSuite, setGain_repeats_running_refresh) {
+  testing::InSequence seq;
+
+  EXPECT_CALL(*this, onChangeCallback(1, 100));
+  EXPECT_CALL(*this, onChangeCallback(2, 100));
+  EXPECT_CALL(*this, onChangeCallback(1, 50));
+  EXPECT_CALL(*this, onChangeCallback(2, 0));
+  EXPECT_CALL(*this, onChangeCallback(1, 0));
+  EXPECT_CALL(*this, onChangeCallback(2, 0));
+
+  mDut.setDmxValue({1, 100});
+  mDut.setDmxValue({2, 100});
+  mDut.setRefreshBudget(1);
+
+  mDut.setGain(kUnityGainValue / 2);
+  mDut.refresh();
+  mDut.setGain(0);
+  mDut.refresh();
+  mDut.refresh();  // now the end of the scene is reached
+  EXPECT_TRUE(mDut.isRefreshing());
+  mDut.refresh();
+  mDut.refresh();
+  mDut.refresh();
+  EXPECT_FALSE(mDut.isRefreshing());
+}
+
+/**
+ * @brief This test case checks whether resetting the refresh budget to 0 completes a pending
+ * refresh immediately.
+ *
+ */
+TEST_F(DmxTestSuite, setRefreshBudget_zero_completes_refresh) {
+  EXPECT_CALL(*this, onChangeCallback(1, 100));
+  EXPECT_CALL(*this, onChangeCallback(1, 0));
+
+  mDut.setDmxValue({1, 100});
+  mDut.setRefreshBudget(1);
+  mDut.setGain(0);
+  mDut.setRefreshBudget(0);
+  EXPECT_FALSE(mDut.isRefreshing());
+}
+
+#if MIDIDMXBRIDGE_STATS
+/**
+ * @brief This test case checks whether the function mididmxbridge::dmx::Dmx::callbackCount()
+ * counts every triggered callback in the immediate and the frame-based mode.
+ *
+ */
+TEST_F(DmxTestSuite, callbackCount_shall_count_callbacks) {
+  EXPECT_CALL(*this, onChangeCallback(_, _)).Times(2);
+
+  mDut.setDmxValue({1, 100});
+  mDut.setDmxValue({2, 100});
+  mDut.setDmxValue({2, 100});  // unchanged, no callback
+  EXPECT_EQ(mDut.callbackCount(), 2);
+
+#if MIDIDMXBRIDGE_USE_FRAME_MODE
+  EXPECT_CALL(*this, onChangeCallback(_, _)).Times(2);
+
+  mDut.setFrameMode(true);
+  mDut.setDmxValue({1, 50});
+  mDut.setDmxValue({3, 50});
+  mDut.flush();
+  EXPECT_EQ(mDut.callbackCount(), 4);
+#endif
+
+  mDut.resetStats();
+  EXPECT_EQ(mDut.callbackCount(), 0);
+}
+#endif
+
+/**
+ * @brief This test case checks whether all controllers are coalescable with the 7-bit resolution,
+ * but not the stateful controllers with the other resolutions.
+ *
+ */
+TEST_F(DmxTestSuite, isCoalescable_depends_on_resolution) {
+  EXPECT_TRUE(mDut.isCoalescable(0));
+  EXPECT_TRUE(mDut.isCoalescable(99));
+
+#if MIDIDMXBRIDGE_USE_HIGH_RES
+  mDut.setResolution(DmxResolution::k8Bit);
+  EXPECT_FALSE(mDut.isCoalescable(0));
+  EXPECT_FALSE(mDut.isCoalescable(99));
+  EXPECT_TRUE(mDut.isCoalescable(64));
+#endif
+}
+
+/**
+ * @brief This test case checks whether setting the static scene again overwrites the channels
+ * instead of sending them repeatedly.
+ *
+ */
+TEST_F(DmxTestSuite, setStaticScene_overwrites_channels) {
+  EXPECT_CALL(*this, onChangeCallback(mDmxRgbChannels.red[0], 7));
+  EXPECT_CALL(*this, onChangeCallback(mDmxRgbChannels.green[0], 8));
+  EXPECT_CALL(*this, onChangeCallback(mDmxRgbChannels.blue[0], 9));
+
+  for (uint8_t idx = 0; idx < 100; idx++) {
+    mDut.setStaticScene(mDmxRgbChannels, mDmxRgb);
+  }
+  mDut.setStaticScene(mDmxRgbChannels, {7, 8, 9});
+  mDut.activateStaticScene();
+}
+
+/**
+ * @brief This test case checks whether the presets of the static scene are range checked.
+ *
+ */
+TEST_F(DmxTestSuite, staticScene_slots_are_range_checked) {
+  EXPECT_TRUE(mDut.setStaticScene(kStaticSceneSlots - 1, mDmxRgbChannels, mDmxRgb));
+  EXPECT_FALSE(mDut.setStaticScene(kStaticSceneSlots, mDmxRgbChannels, mDmxRgb));
+  EXPECT_TRUE(mDut.clearStaticScene(kStaticSceneSlots - 1));
+  EXPECT_FALSE(mDut.clearStaticScene(kStaticSceneSlots));
+  EXPECT_TRUE(mDut.selectStaticScene(kStaticSceneSlots - 1));
+  EXPECT_FALSE(mDut.selectStaticScene(kStaticSceneSlots));
+  EXPECT_EQ(mDut.staticSceneSlot(), kStaticSceneSlots - 1);
+}
+
+/**
+ * @brief This test case checks whether selecting a preset while the static scene is active
+ * outputs the selected preset and turns off the channels missing in it.
+ *
+ */
+TEST_F(DmxTestSuite, selectStaticScene_outputs_selected_preset) {
+  DmxRgbChannels channels;
+  channels.red.push_back(1);
+  channels.green.push_back(4);
+
+  mDut.setStaticScene(0, mDmxRgbChannels, mDmxRgb);
+  mDut.setStaticScene(1, channels, {5, 6, 0});
+  mDut.activateStaticScene();
+
+  testing::InSequence s;
+  EXPECT_CALL(*this, onChangeCallback(1, 5));
+  EXPECT_CALL(*this, onChangeCallback(2, 0));
+  EXPECT_CALL(*this, onChangeCallback(3, 0));
+  EXPECT_CALL(*this, onChangeCallback(4, 6));
+
+  EXPECT_TRUE(mDut.selectStaticScene(1));
+  EXPECT_TRUE(mDut.selectStaticScene(1));
+}
+
+/**
+ * @brief This test case checks whether selecting a preset while the dynamic scene is active
+ * outputs nothing until the static scene gets activated.
+ *
+ */
+TEST_F(DmxTestSuite, selectStaticScene_defers_output_with_dynamic_scene) {
+  mDut.setStaticScene(1, mDmxRgbChannels, mDmxRgb);
+  mDut.clearStaticScene(0);
+
+  EXPECT_CALL(*this, onChangeCallback(_, _)).Times(0);
+  mDut.selectStaticScene(1);
+  testing::Mock::VerifyAndClearExpectations(this);
+
+  EXPECT_CALL(*this, onChangeCallback(mDmxRgbChannels.red[0], mDmxRgb.red));
+  EXPECT_CALL(*this, onChangeCallback(mDmxRgbChannels.green[0], mDmxRgb.green));
+  EXPECT_CALL(*this, onChangeCallback(mDmxRgbChannels.blue[0], mDmxRgb.blue));
+  mDut.activateStaticScene();
+}
+
+/**
+ * @brief This test case checks whether switching the scene outputs only the channels whose scaled
+ * output changes.
+ *
+ */
+TEST_F(DmxTestSuite, activateStaticScene_sends_only_changed_channels) {
+  mDut.setGain(kGainMaxValue / 2);
+  mDut.setStaticScene(mDmxRgbChannels, mDmxRgb);
+  mDut.setDmxValue({1, 20});  // 21 and 20 are both scaled to 10
+  mDut.setDmxValue({2, 40});
+  mDut.setDmxValue({4, 50});
+
+  EXPECT_CALL(*this, onChangeCallback(2, 21));
+  EXPECT_CALL(*this, onChangeCallback(3, 31));
+  EXPECT_CALL(*this, onChangeCallback(4, 0));
+
+  mDut.activateStaticScene();
+}
+
+/**
+ * @brief This test case checks whether switching the scene with a response curve outputs only the
+ * channels whose curved output changes.
+ *
+ */
+TEST_F(DmxTestSuite, activateStaticScene_with_curve_sends_only_changed_channels) {
+  mDut.setCurve(DmxCurve::kGamma);
+  mDut.setStaticScene(mDmxRgbChannels, mDmxRgb);
+  mDut.setDmxValue({1, mDmxRgb.red});
+  mDut.setDmxValue({5, 99});
+
+  EXPECT_CALL(*this, onChangeCallback(1, _)).Times(0);
+  EXPECT_CALL(*this, onChangeCallback(2, applyCurve(DmxCurve::kGamma, mDmxRgb.green)));
+  EXPECT_CALL(*this, onChangeCallback(3, applyCurve(DmxCurve::kGamma, mDmxRgb.blue)));
+  EXPECT_CALL(*this, onChangeCallback(5, 0));
+
+  mDut.activateStaticScene();
+}
+
+/**
+ * @brief This test case checks whether switching to a scene identical to the active one outputs
+ * nothing.
+ *
+ */
+TEST_F(DmxTestSuite, activateDynamicScene_skips_identical_scene) {
+  mDut.setStaticScene(mDmxRgbChannels, mDmxRgb);
+  mDut.setDmxValue({1, mDmxRgb.red});
+  mDut.setDmxValue({2, mDmxRgb.green});
+  mDut.setDmxValue({3, mDmxRgb.blue});
+  mDut.activateStaticScene();
+
+  EXPECT_CALL(*this, onChangeCallback(_, _)).Times(0);
+
   mDut.activateDynamicScene();
 }
+
+/**
+ * @brief This test case checks whether the static presets are persisted and the restored active
+ * scene is output.
+ *
+ */
+TEST_F(DmxTestSuite, restoreScenes_outputs_restored_scene) {
+  SceneStoreFake store(Dmx::sceneStoreSize());
+
+  EXPECT_FALSE(mDut.restoreScenes());
+
+  mDut.setSceneStore(&store);
+  mDut.setSceneSaveDelay(0);
+  EXPECT_FALSE(mDut.restoreScenes());
+  mDut.setStaticScene(1, mDmxRgbChannels, mDmxRgb);
+
+  while (!mDut.isSceneSaved()) {
+    mDut.persist(0);
+  }
+
+  Dmx dut(std::bind(&DmxTestSuite::onChangeCallback, this, _1, _2));
+  dut.setSceneStore(&store);
+  dut.selectStaticScene(1);
+  dut.activateStaticScene();
+
+  EXPECT_CALL(*this, onChangeCallback(mDmxRgbChannels.red[0], mDmxRgb.red));
+  EXPECT_CALL(*this, onChangeCallback(mDmxRgbChannels.green[0], mDmxRgb.green));
+  EXPECT_CALL(*this, onChangeCallback(mDmxRgbChannels.blue[0], mDmxRgb.blue));
+
+  EXPECT_TRUE(dut.restoreScenes());
+}
+/**
+ * @brief This test case checks whether the mididmxbridge::dmx::Dmx::setCurve() function outputs the
+ * active scene with the curve and the gain applied.
+ *
+ */
+TEST_F(DmxTestSuite, setCurve_applies_curve_and_gain) {
+  testing::InSequence seq;
+
+  EXPECT_CALL(*this, onChangeCallback(1, 128));
+  EXPECT_CALL(*this, onChangeCallback(1, applyCurve(DmxCurve::kGamma, 128)));
+  EXPECT_CALL(*this, onChangeCallback(1, applyCurve(DmxCurve::kGamma, 128) / 2));
+  EXPECT_CALL(*this, onChangeCallback(1, 64));
+
+  mDut.setDmxValue({1, 128});
+  mDut.setCurve(DmxCurve::kGamma);
+  EXPECT_EQ(mDut.curve(), DmxCurve::kGamma);
+  mDut.setCurve(DmxCurve::kGamma);
+  mDut.setGain(kUnityGainValue / 2);
+  mDut.setCurve(DmxCurve::kLinear);
+}
+
+/**
+ * @brief This test case checks whether the response curve is applied to all possible DMX values
+ * exactly like without the gain lookup table.
+ *
+ */
+TEST_F(DmxTestSuite, setCurve_scales_all_values_exactly) {
+  const uint16_t gain = kUnityGainValue / 3;
+  std::vector<uint8_t> expected;
+  std::vector<uint8_t> actual;
+
+  ON_CALL(*this, onChangeCallback(_, _)).WillByDefault([&](const uint8_t, const uint8_t value) {
+    actual.push_back(value);
+  });
+
+  mDut.setCurve(DmxCurve::kSCurve);
+  mDut.setGain(gain);
+  actual.clear();
+  for (uint16_t value = 0; value <= 255; value++) {
+    expected.push_back((applyCurve(DmxCurve::kSCurve, (uint8_t)value) * gain) / kUnityGainValue);
+    mDut.setDmxValue({(uint8_t)(value % 2), (uint8_t)value});
+  }
+
+  EXPECT_EQ(actual, expected);
+}
+
+#if MIDIDMXBRIDGE_USE_HIGH_RES
+/**
+ * @brief This test case checks whether the 16-bit output of a coarse and fine channel pair rises
+ * monotonically with the 14-bit MIDI value for every response curve while a gain is applied.
+ *
+ */
+TEST_F(DmxTestSuite, setResolution_16bit_scales_pair_monotonically) {
+  uint8_t output[3] = {0, 0, 0};
+
+  ON_CALL(*this, onChangeCallback(_, _)).WillByDefault([&](const uint16_t ch, const uint8_t value) {
+    output[ch] = value;
+  });
+
+  for (const DmxCurve curve : {DmxCurve::kLinear, DmxCurve::kGamma, DmxCurve::kSCurve}) {
+    uint16_t previous = 0;
+
+    mDut.setResolution(DmxResolution::k16Bit);
+    mDut.setCurve(curve);
+    mDut.setGain(kGainMaxValue / 2);
+
+    for (uint16_t value = 0; value < (1 << 14); value++) {
+      if (0 == (value & 0x7f)) {
+        mDut.setMidiCcValue(1, (uint8_t)(value >> 7));  // the MSB resets the LSB
+      } else {
+        mDut.setMidiCcValue(33, (uint8_t)(value & 0x7f));
+      }
+
+      const uint16_t actual = (output[1] << 8) | output[2];
+      ASSERT_GE(actual, previous) << "curve " << (int)curve << ", value " << value;
+      previous = actual;
+    }
+
+    EXPECT_GE(previous, 0x7f00);  // full scale at half gain
+  }
+}
+
+/**
+ * @brief This test case checks whether a crossfade mixes a coarse and fine channel pair as 16-bit
+ * value, i.e. the output stays between the values of both scenes.
+ *
+ */
+TEST_F(DmxTestSuite, fade_mixes_16bit_pair_as_a_whole) {
+  uint8_t output[3] = {0, 0, 0};
+  const uint16_t dynamicValue = 0x81fe;
+  const uint16_t staticValue = 0x8200;
+
+  ON_CALL(*this, onChangeCallback(_, _)).WillByDefault([&](const uint16_t ch, const uint8_t value) {
+    output[ch % 3] = value;
+  });
+
+  mDut.setResolution(DmxResolution::k16Bit);
+  mDut.setMidiCcValue(1, 0x40);
+  mDut.setMidiCcValue(33, 0x7f);
+  ASSERT_EQ((output[1] << 8) | output[2], dynamicValue);
+
+  mDut.setStaticScene(mDmxRgbChannels, {(uint8_t)(staticValue >> 8), (uint8_t)staticValue, 0});
+  mDut.setFadeTime(100);
+  mDut.activateStaticScene();
+
+  for (uint32_t now_ms = 1000; now_ms <= 1100; now_ms += 25) {
+    mDut.fade(now_ms);
+
+    EXPECT_GE((output[1] << 8) | output[2], dynamicValue) << "at " << now_ms;
+    EXPECT_LE((output[1] << 8) | output[2], staticValue) << "at " << now_ms;
+  }
+  EXPECT_EQ((output[1] << 8) | output[2], staticValue);
+}
+
+/**
+ * @brief This test case checks whether a static scene outputs its own values on the channels of a
+ * 16-bit pair of the dynamic scene, i.e. the pairs apply to the dynamic scene only.
+ *
+ */
+TEST_F(DmxTestSuite, activateStaticScene_ignores_16bit_pairs_of_dynamic_scene) {
+  uint8_t output[4] = {0, 0, 0, 0};
+
+  ON_CALL(*this, onChangeCallback(_, _)).WillByDefault([&](const uint16_t ch, const uint8_t value) {
+    output[ch % 4] = value;
+  });
+
+  mDut.setResolution(DmxResolution::k16Bit);
+  mDut.setGain(kGainMaxValue * 3 / 4);
+  mDut.setMidiCcValue(1, 0x40);
+  mDut.setMidiCcValue(33, 0x7f);
+
+  mDut.setStaticScene(mDmxRgbChannels, {0x42, 0x42, 0x42});
+  mDut.activateStaticScene();
+
+  EXPECT_EQ(output[1], output[3]);
+  EXPECT_EQ(output[2], output[3]);
+}
+#endif
 }  // namespace mididmxbridge::unittest
@@ -0,0 +1,129 @@
+/**
+ * @file FrameKernelsTests.cpp
+ * @author Christian Neukam
+ * @brief Unit Tests for the DMX frame kernels
+ * @version 1.0
+ * @date 2024-03-18
+ *
+ * @copyright Copyright 2024 Christian Neukam. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+#include "FrameKernels.h"
+#include "constants.h"
+
+namespace mididmxbridge::unittest {
+using namespace mididmxbridge::dmx;
+
+/**
+ * @brief This class provides the fixture for the Test Suite, which checks the frame kernels for
+ * several frame sizes, i.e. with and without a scalar tail.
+ *
+ */
+class FrameKernelsTestSuite : public testing::TestWithParam<uint16_t> {
+ public:
+  /**
+   * @brief Construct a new FrameKernelsTestSuite object with a frame of varying DMX values.
+   *
+   */
+  FrameKernelsTestSuite() : mFrame(GetParam()) {
+    for (uint16_t idx = 0; idx < mFrame.size(); idx++) {
+      mFrame[idx] = (uint8_t)(idx * 37 + 11);
+    }
+  }
+
+ protected:
+  std::vector<uint8_t> mFrame; /**< the frame to process */
+};
+
+INSTANTIATE_TEST_SUITE_P(FrameKernels, FrameKernelsTestSuite,
+                         testing::Values(0, 1, 15, 16, 17, 127, 128, 511, 512),
+                         [](const testing::TestParamInfo<FrameKernelsTestSuite::ParamType>& info) {
+                           return std::to_string(info.param);
+                         });
+
+/**
+ * @brief This test case checks whether the mididmxbridge::dmx::scaleFrame() function scales every
+ * value exactly like the per-channel arithmetic, including the clipping of the gain.
+ *
+ */
+TEST_P(FrameKernelsTestSuite, scaleFrame_matches_scalar_scaling) {
+  for (const uint16_t gain : {0, 1, 341, 512, 1000, 1023, 1024, 2000}) {
+    const uint32_t factor = (gain < kUnityGainValue) ? gain : kUnityGainValue;
+    std::vector<uint8_t> expected(mFrame.size());
+    std::vector<uint8_t> actual(mFrame.size());
+
+    for (uint16_t idx = 0; idx < mFrame.size(); idx++) {
+      expected[idx] = (mFrame[idx] * factor) >> kAnalogReadBits;
+    }
+    scaleFrame(mFrame.data(), actual.data(), mFrame.size(), gain);
+
+    EXPECT_EQ(actual, expected) << "gain " << gain;
+  }
+}
+
+/**
+ * @brief This test case checks whether the mididmxbridge::dmx::scaleFrame() function scales a frame
+ * in place.
+ *
+ */
+TEST_P(FrameKernelsTestSuite, scaleFrame_in_place) {
+  std::vector<uint8_t> expected(mFrame.size());
+
+  scaleFrame(mFrame.data(), expected.data(), mFrame.size(), kUnityGainValue / 3);
+  scaleFrame(mFrame.data(), mFrame.data(), mFrame.size(), kUnityGainValue / 3);
+
+  EXPECT_EQ(mFrame, expected);
+}
+
+/**
+ * @brief This test case checks whether the mididmxbridge::dmx::diffFrame() function flags exactly
+ * the differing channels and clears the unused bits of the last mask byte.
+ *
+ */
+TEST_P(FrameKernelsTestSuite, diffFrame_flags_differing_channels) {
+  std::vector<uint8_t> other(mFrame);
+  std::vector<uint8_t> expected((mFrame.size() + 7) / 8, 0x00);
+  std::vector<uint8_t> actual(expected.size(), 0xff);
+
+  for (uint16_t idx = 0; idx < other.size(); idx++) {
+    if ((0 == (idx % 3)) || (idx == (other.size() - 1))) {
+      other[idx] ^= (uint8_t)(1 << (idx & 0x07));
+      expected[idx >> 3] |= (uint8_t)(1 << (idx & 0x07));
+    }
+  }
+
+  EXPECT_EQ(diffFrame(mFrame.data(), other.data(), mFrame.size(), actual.data()),
+            !mFrame.empty());
+  EXPECT_EQ(actual, expected);
+}
+
+/**
+ * @brief This test case checks whether the mididmxbridge::dmx::diffFrame() function reports
+ * identical frames with a cleared mask.
+ *
+ */
+TEST_P(FrameKernelsTestSuite, diffFrame_identical_frames) {
+  const std::vector<uint8_t> other(mFrame);
+  std::vector<uint8_t> actual((mFrame.size() + 7) / 8, 0xff);
+
+  EXPECT_FALSE(diffFrame(mFrame.data(), other.data(), mFrame.size(), actual.data()));
+  EXPECT_EQ(actual, std::vector<uint8_t>(actual.size(), 0x00));
+}
+}  // namespace mididmxbridge::unittest
@@ -0,0 +1,126 @@
+/**
+ * @file GainFilterTests.cpp
+ * @author Christian Neukam
+ * @brief Unit Tests for the mididmxbridge::dmx::GainFilter class
+ * @version 1.0
+ * @date 2024-03-15
+ *
+ * @copyright Copyright 2024 Christian Neukam. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "GainFilter.h"
+
+namespace mididmxbridge::unittest {
+using namespace mididmxbridge::dmx;
+
+static const uint16_t kLevelStep = 8; /**< the gain difference of two quantised levels */
+
+/**
+ * @brief This test case checks whether the filter starts with unity gain and the first sample is
+ * applied immediately.
+ *
+ */
+TEST(GainFilterTestSuite, first_sample_applies_immediately) {
+  GainFilter dut;
+
+  EXPECT_EQ(dut.gain(), kUnityGainValue);
+  EXPECT_TRUE(dut.isDue(0));
+  EXPECT_TRUE(dut.update(kUnityGainValue / 2, 0));
+  EXPECT_EQ(dut.gain(), kUnityGainValue / 2);
+}
+
+/**
+ * @brief This test case checks whether a sample close to the current gain, e.g. the maximum ADC
+ * value 1023 at unity gain, does not change the gain.
+ *
+ */
+TEST(GainFilterTestSuite, sample_within_hysteresis_keeps_gain) {
+  GainFilter dut;
+
+  EXPECT_FALSE(dut.update(kUnityGainValue - 1, 0));
+  EXPECT_EQ(dut.gain(), kUnityGainValue);
+}
+
+/**
+ * @brief This test case checks whether the noise of the analog input does not change the gain.
+ *
+ */
+TEST(GainFilterTestSuite, noise_keeps_gain) {
+  GainFilter dut;
+
+  dut.setInterval(0);
+  dut.update(300, 0);
+  const uint16_t gain = dut.gain();
+
+  for (uint16_t sample = 0; sample < 1000; sample++) {
+    EXPECT_FALSE(dut.update(300 - 3 + (sample * 3) % 7, sample));  // ±3 around the sample
+  }
+  EXPECT_EQ(dut.gain(), gain);
+}
+
+/**
+ * @brief This test case checks whether samples before the interval elapsed are discarded.
+ *
+ */
+TEST(GainFilterTestSuite, update_decimates_samples) {
+  GainFilter dut;
+
+  dut.setInterval(20);
+  EXPECT_TRUE(dut.update(0, 100));
+  EXPECT_FALSE(dut.isDue(119));
+  EXPECT_FALSE(dut.update(kUnityGainValue, 119));
+  EXPECT_EQ(dut.gain(), 0);
+  EXPECT_TRUE(dut.isDue(120));
+  EXPECT_TRUE(dut.update(kUnityGainValue, 120));
+  EXPECT_GT(dut.gain(), 0);
+}
+
+/**
+ * @brief This test case checks whether the filter tracks a slowly moving knob level by level and
+ * reaches both ends of the range.
+ *
+ */
+TEST(GainFilterTestSuite, update_tracks_slow_movement) {
+  GainFilter dut;
+  uint16_t changes = 0;
+  uint32_t now_ms = 0;
+
+  dut.setInterval(0);
+  dut.update(0, now_ms);
+  EXPECT_EQ(dut.gain(), 0);
+
+  for (uint16_t sample = 0; sample < kUnityGainValue; sample++) {
+    const uint16_t gain = dut.gain();
+
+    if (dut.update(sample, now_ms++)) {
+      EXPECT_EQ(dut.gain(), gain + kLevelStep);
+      changes++;
+    }
+  }
+  for (uint8_t settle = 0; settle < 32; settle++) {
+    dut.update(kUnityGainValue - 1, now_ms++);
+  }
+
+  EXPECT_EQ(dut.gain(), kUnityGainValue);
+  EXPECT_EQ(changes + 1, kUnityGainValue / kLevelStep);
+
+  for (uint8_t settle = 0; settle < 32; settle++) {
+    dut.update(0, now_ms++);
+  }
+  EXPECT_EQ(dut.gain(), 0);
+}
+}  // namespace mididmxbridge::unittest
@@ -0,0 +1,166 @@
+/**
+ * @file HighResDecoderTests.cpp
+ * @author Christian Neukam
+ * @brief Unit Tests for the mididmxbridge::midi::HighResDecoder class.
+ * @version 1.0
+ * @date 2024-03-02
+ *
+ * @copyright Copyright 2024 Christian Neukam. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "HighResDecoder.h"
+
+namespace mididmxbridge::unittest {
+using mididmxbridge::midi::HighResDecoder;
+using mididmxbridge::midi::HighResValue;
+using Result = HighResDecoder::Result;
+
+/**
+ * @brief This test case tests whether mididmxbridge::midi::HighResDecoder decodes an MSB on its own
+ * and refines it by the LSB of the controller 32 above.
+ *
+ */
+TEST(HighResDecoderTestSuite, decode_14bit_cc_pair) {
+  HighResDecoder dut;
+  HighResValue result = {0, 0, false};
+
+  EXPECT_EQ(dut.decode(7, 0x40, 1, result), Result::kValue);
+  EXPECT_EQ(result.parameter, 7);
+  EXPECT_EQ(result.value, 0x2000);
+  EXPECT_FALSE(result.isNrpn);
+
+  EXPECT_EQ(dut.decode(39, 0x7f, 1, result), Result::kValue);
+  EXPECT_EQ(result.parameter, 7);
+  EXPECT_EQ(result.value, 0x207f);
+}
+
+/**
+ * @brief This test case tests whether mididmxbridge::midi::HighResDecoder consumes an LSB without
+ * a matching MSB on the same MIDI channel.
+ *
+ */
+TEST(HighResDecoderTestSuite, decode_lsb_without_msb_is_consumed) {
+  HighResDecoder dut;
+  HighResValue result = {0, 0, false};
+
+  EXPECT_EQ(dut.decode(39, 0x7f, 1, result), Result::kConsumed);
+  EXPECT_EQ(dut.decode(7, 0x40, 2, result), Result::kValue);
+  EXPECT_EQ(dut.decode(39, 0x7f, 1, result), Result::kConsumed);
+  EXPECT_EQ(dut.decode(40, 0x7f, 2, result), Result::kConsumed);
+}
+
+/**
+ * @brief This test case tests whether mididmxbridge::midi::HighResDecoder decodes the data entry
+ * of a selected NRPN parameter.
+ *
+ */
+TEST(HighResDecoderTestSuite, decode_nrpn) {
+  HighResDecoder dut;
+  HighResValue result = {0, 0, false};
+
+  EXPECT_EQ(dut.decode(99, 0x02, 1, result), Result::kConsumed);
+  EXPECT_EQ(dut.decode(98, 0x01, 1, result), Result::kConsumed);
+  EXPECT_EQ(dut.decode(6, 0x7f, 1, result), Result::kValue);
+  EXPECT_EQ(result.parameter, 0x0101);
+  EXPECT_EQ(result.value, 0x3f80);
+  EXPECT_TRUE(result.isNrpn);
+
+  EXPECT_EQ(dut.decode(38, 0x7f, 1, result), Result::kValue);
+  EXPECT_EQ(result.value, 0x3fff);
+}
+
+/**
+ * @brief This test case tests whether selecting an RPN deselects the NRPN parameter and whether the
+ * data entry of the RPN is dropped, i.e. it drives neither the NRPN nor the controller 6 or 38.
+ *
+ */
+TEST(HighResDecoderTestSuite, decode_rpn_data_entry_is_dropped) {
+  HighResDecoder dut;
+  HighResValue result = {0, 0, false};
+
+  dut.decode(99, 0x00, 1, result);
+  dut.decode(98, 0x01, 1, result);
+  EXPECT_EQ(dut.decode(101, 0x00, 1, result), Result::kConsumed);
+  EXPECT_EQ(dut.decode(100, 0x00, 1, result), Result::kConsumed);
+  EXPECT_EQ(dut.decode(6, 0x10, 1, result), Result::kConsumed);
+  EXPECT_EQ(dut.decode(38, 0x20, 1, result), Result::kConsumed);
+  EXPECT_EQ(result.parameter, 0);
+  EXPECT_EQ(result.value, 0);
+}
+
+/**
+ * @brief This test case tests whether selecting the null parameter 127/127 stops the routing of
+ * the data entry to the NRPN or RPN, i.e. the controllers 6 and 38 form a 14-bit pair again.
+ *
+ */
+TEST(HighResDecoderTestSuite, decode_null_parameter_stops_routing) {
+  HighResDecoder dut;
+  HighResValue result = {0, 0, false};
+
+  dut.decode(99, 0x00, 1, result);
+  dut.decode(98, 0x01, 1, result);
+  ASSERT_EQ(dut.decode(6, 0x10, 1, result), Result::kValue);
+  ASSERT_TRUE(result.isNrpn);
+
+  dut.decode(99, 0x7f, 1, result);
+  dut.decode(98, 0x7f, 1, result);
+  EXPECT_EQ(dut.decode(6, 0x10, 1, result), Result::kValue);
+  EXPECT_FALSE(result.isNrpn);
+  EXPECT_EQ(result.parameter, 6);
+
+  dut.decode(101, 0x00, 1, result);
+  dut.decode(100, 0x00, 1, result);
+  dut.decode(101, 0x7f, 1, result);
+  dut.decode(100, 0x7f, 1, result);
+  EXPECT_EQ(dut.decode(6, 0x20, 1, result), Result::kValue);
+  EXPECT_FALSE(result.isNrpn);
+  EXPECT_EQ(result.value, 0x20 << 7);
+}
+
+/**
+ * @brief This test case tests whether mididmxbridge::midi::HighResDecoder passes through all
+ * other MIDI CC controllers and forgets the state on reset().
+ *
+ */
+TEST(HighResDecoderTestSuite, decode_other_controllers_pass_through) {
+  HighResDecoder dut;
+  HighResValue result = {0, 0, false};
+
+  EXPECT_EQ(dut.decode(64, 0x10, 1, result), Result::kPassThrough);
+  EXPECT_EQ(dut.decode(127, 0x10, 1, result), Result::kPassThrough);
+
+  dut.decode(7, 0x40, 1, result);
+  dut.reset();
+  EXPECT_EQ(dut.decode(39, 0x7f, 1, result), Result::kConsumed);
+}
+
+/**
+ * @brief This test case tests whether mididmxbridge::midi::HighResDecoder::isStateful() classifies
+ * the 14-bit pairs and the NRPN/RPN parameter selection as stateful.
+ *
+ */
+TEST(HighResDecoderTestSuite, isStateful_classifies_controllers) {
+  EXPECT_TRUE(HighResDecoder::isStateful(0));
+  EXPECT_TRUE(HighResDecoder::isStateful(63));
+  EXPECT_FALSE(HighResDecoder::isStateful(64));
+  EXPECT_FALSE(HighResDecoder::isStateful(97));
+  EXPECT_TRUE(HighResDecoder::isStateful(98));
+  EXPECT_TRUE(HighResDecoder::isStateful(101));
+  EXPECT_FALSE(HighResDecoder::isStateful(102));
+  EXPECT_FALSE(HighResDecoder::isStateful(127));
+}
+}  // namespace mididmxbridge::unittest
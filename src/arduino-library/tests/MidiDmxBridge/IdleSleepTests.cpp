@@ -0,0 +1,83 @@
+/**
+ * @file IdleSleepTests.cpp
+ * @author Christian Neukam
+ * @brief Unit Tests for the idle sleep of the serial readers
+ * @version 1.0
+ * @date 2024-03-17
+ *
+ * @copyright Copyright 2024 Christian Neukam. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "IdleSleep.h"
+#include "SerialReaderSimulator.h"
+
+namespace mididmxbridge::unittest {
+/**
+ * @brief This test case checks whether mididmxbridge::idleWait() does not wait if data is already
+ * available.
+ *
+ */
+TEST(IdleSleepTestSuite, idleWait_returns_if_data_available) {
+  SerialReaderSimulator serial;
+  uint16_t waits = 0;
+
+  serial.send(0, {0xf8});
+  serial.advance(SerialReaderSimulator::kByteTimeUs);
+  idleWait(serial, 3, [&waits]() { waits++; });
+
+  EXPECT_EQ(waits, 0);
+}
+
+/**
+ * @brief This test case checks whether mididmxbridge::idleWait() waits from interrupt to
+ * interrupt until the sleep time elapsed if no data is received.
+ *
+ */
+TEST(IdleSleepTestSuite, idleWait_waits_for_sleep_time) {
+  SerialReaderSimulator serial;
+  uint16_t waits = 0;
+
+  idleWait(serial, 3, [&serial, &waits]() {
+    serial.advance(SerialReaderSimulator::kTimerTickUs);
+    waits++;
+  });
+
+  EXPECT_EQ(waits, 3);
+  EXPECT_EQ(serial.millis(), 3u);
+}
+
+/**
+ * @brief This test case checks whether the idle sleep ends right after a byte is received instead
+ * of at the end of the sleep time.
+ *
+ */
+TEST(IdleSleepTestSuite, sleep_wakes_up_on_received_byte) {
+  SerialReaderSimulator serial;
+
+  serial.setIdleWake(true);
+  serial.send(500, {0xf8});
+  serial.sleep(3);
+
+  EXPECT_EQ(serial.micros(), 500 + SerialReaderSimulator::kByteTimeUs);
+  EXPECT_EQ(serial.available(), 1);
+
+  serial.read();
+  serial.sleep(3);
+  EXPECT_EQ(serial.millis(), 3u);
+  EXPECT_LT(serial.micros(), 3000 + SerialReaderSimulator::kTimerTickUs);
+}
+}  // namespace mididmxbridge::unittest
@@ -23,12 +23,14 @@
 #include <gtest/gtest.h>
 
 #include "MidiDmxBridge.h"
+#include "SceneStoreFake.h"
 #include "SerialReaderMock.h"
 
 namespace mididmxbridge::unittest {
 using std::placeholders::_1;
 using std::placeholders::_2;
 using testing::_;
+using testing::MockFunction;
 using testing::NiceMock;
 
 /**
@@ -54,7 +56,7 @@ class mididmxbridgeTestSuite : public testing::Test {
    * @brief Mock method for mididmxbridge::dmx::DmxOnChangeCallback.
    *
    */
-  MOCK_METHOD(void, onChangeCallback, (const uint8_t channel, const uint8_t value), ());
+  MOCK_METHOD(void, onChangeCallback, (const uint16_t channel, const uint8_t value), ());
 
  protected:
   const uint8_t mChannel;                 /**< the MIDI channel to test */
@@ -105,7 +107,7 @@ TEST_F(mididmxbridgeTestSuite, listen_shall_not_trigger_callback_with_invalid_se
  *
  */
 TEST_F(mididmxbridgeTestSuite, switchToStaticScene_triggers_callback_with_static_scene) {
-  const std::vector<uint8_t> channels{1, 2, 3};
+  const std::vector<uint16_t> channels{1, 2, 3};
 
   EXPECT_CALL(*this, onChangeCallback(_, _)).Times(3);  // expect 3 callbacks for r, g and b
 
@@ -138,5 +140,456 @@ TEST_F(mididmxbridgeTestSuite, setAttenuation_shall_trigger_callback) {
 
   mDut.listen();
   mDut.setAttenuation(gain);
+  mDut.listen();
+}
+
+#if MIDIDMXBRIDGE_USE_SINKS
+/**
+ * @brief This test case tests whether the function MidiDmxBridge::listen() writes the sinks added
+ * via MidiDmxBridge::addSink() in addition to the mididmxbridge::dmx::DmxOnChangeCallback callback.
+ *
+ */
+TEST_F(mididmxbridgeTestSuite, listen_shall_write_sinks) {
+  MockFunction<void(const uint8_t*, const uint16_t, const uint16_t)> sink;
+
+  EXPECT_CALL(*this, onChangeCallback(mSerialData[1], mSerialData[2] << 1));
+  EXPECT_CALL(sink, Call(_, 0, kMaxDmxChannel + 1))
+      .WillOnce([this](const uint8_t* values, const uint16_t, const uint16_t) {
+        EXPECT_EQ(values[mSerialData[1]], mSerialData[2] << 1);
+      });
+
+  EXPECT_TRUE(mDut.addSink(sink.AsStdFunction()));
+  mDut.listen();
+  mDut.listen();
+}
+#endif
+
+/**
+ * @brief This test case tests whether the function MidiDmxBridge::updateAttenuation() refreshes the
+ * DMX channels only once for a noisy analog input.
+ *
+ */
+TEST_F(mididmxbridgeTestSuite, updateAttenuation_shall_ignore_noise) {
+  uint32_t now_ms = 0;
+
+  ON_CALL(mSerial, millis()).WillByDefault(testing::ReturnPointee(&now_ms));
+  EXPECT_CALL(*this, onChangeCallback(mSerialData[1], mSerialData[2] << 1));
+  EXPECT_CALL(*this, onChangeCallback(mSerialData[1], mSerialData[2]));
+
+  mDut.listen();
+  for (uint16_t sample = 0; sample < 100; sample++) {
+    EXPECT_TRUE(mDut.isAttenuationDue());
+    mDut.updateAttenuation(kUnityGainValue / 2 - 2 + sample % 5);
+    EXPECT_FALSE(mDut.isAttenuationDue());
+    now_ms += kDefaultAttenuationIntervalMs;
+    mDut.listen();
+  }
+}
+
+/**
+ * @brief This test case tests whether the function MidiDmxBridge::listen() processes all complete
+ * MIDI CC messages available on the serial interface within a single call.
+ *
+ */
+TEST(mididmxbridgeListenTestSuite, listen_shall_drain_all_messages) {
+  const std::vector<uint8_t> serialData = {0xb0, 0x01, 0x02, 0xb0, 0x03, 0x04, 0xb0, 0x05, 0x06};
+  NiceMock<SerialReaderMock> serial(serialData);
+  MockFunction<void(const uint16_t, const uint8_t)> callback;
+  MidiDmxBridge dut(1, callback.AsStdFunction(), serial);
+
+  EXPECT_CALL(callback, Call(0x01, 0x04));
+  EXPECT_CALL(callback, Call(0x03, 0x08));
+  EXPECT_CALL(callback, Call(0x05, 0x0c));
+
+  dut.listen();
+}
+
+/**
+ * @brief This test case tests whether the function MidiDmxBridge::listen() processes no more MIDI
+ * CC messages than set via MidiDmxBridge::setListenBudget() and does not sleep while data is
+ * pending.
+ *
+ */
+TEST(mididmxbridgeListenTestSuite, listen_shall_respect_budget) {
+  const std::vector<uint8_t> serialData = {0xb0, 0x01, 0x02, 0xb0, 0x03, 0x04, 0xb0, 0x05, 0x06};
+  NiceMock<SerialReaderMock> serial(serialData);
+  MockFunction<void(const uint16_t, const uint8_t)> callback;
+  MidiDmxBridge dut(1, callback.AsStdFunction(), serial);
+
+  EXPECT_CALL(callback, Call(_, _)).Times(2);
+  EXPECT_CALL(serial, sleep(_)).Times(0);
+
+  dut.setListenBudget(2);
+  dut.listen();
+}
+
+/**
+ * @brief This test case tests whether the function MidiDmxBridge::listen() sleeps for the idle time
+ * once the serial interface has been drained.
+ *
+ */
+TEST(mididmxbridgeListenTestSuite, listen_shall_sleep_if_drained) {
+  const std::vector<uint8_t> serialData = {0xb0, 0x01, 0x02};
+  NiceMock<SerialReaderMock> serial(serialData);
+  MockFunction<void(const uint16_t, const uint8_t)> callback;
+  MidiDmxBridge dut(1, callback.AsStdFunction(), serial);
+
+  EXPECT_CALL(serial, sleep(7));
+
+  dut.setIdleSleep(7);
+  dut.listen();
+}
+
+/**
+ * @brief This test case tests whether the function MidiDmxBridge::listen() never sleeps if the idle
+ * sleep is disabled.
+ *
+ */
+TEST(mididmxbridgeListenTestSuite, listen_shall_not_sleep_if_disabled) {
+  const std::vector<uint8_t> serialData = {};
+  NiceMock<SerialReaderMock> serial(serialData);
+  MockFunction<void(const uint16_t, const uint8_t)> callback;
+  MidiDmxBridge dut(1, callback.AsStdFunction(), serial);
+
+  EXPECT_CALL(serial, sleep(_)).Times(0);
+
+  dut.setIdleSleep(0);
+  dut.listen();
+}
+#if MIDIDMXBRIDGE_USE_FRAME_MODE
+/**
+ * @brief This test case tests whether the function MidiDmxBridge::listen() triggers only one
+ * callback per changed DMX channel in the frame-based mode.
+ *
+ */
+TEST(mididmxbridgeListenTestSuite, listen_frameMode_shall_trigger_one_callback_per_channel) {
+  const std::vector<uint8_t> serialData = {0xb0, 0x01, 0x02, 0x01, 0x03, 0x01, 0x04};
+  NiceMock<SerialReaderMock> serial(serialData);
+  MockFunction<void(const uint16_t, const uint8_t)> callback;
+  MidiDmxBridge dut(1, callback.AsStdFunction(), serial);
+
+  EXPECT_CALL(callback, Call(0x01, 0x08));
+
+  dut.setFrameMode(true);
+  dut.listen();
+}
+#endif
+
+/**
+ * @brief This test case tests whether the function MidiDmxBridge::listen() outputs MIDI CC
+ * messages on the DMX addresses defined via MidiDmxBridge::patch() for the MIDI
+ * channel listened to.
+ *
+ */
+TEST(mididmxbridgeListenTestSuite, listen_shall_apply_patches) {
+  const std::vector<uint8_t> serialData = {0xb1, 0x01, 0x02, 0xb1, 0x03, 0x04};
+  NiceMock<SerialReaderMock> serial(serialData);
+  MockFunction<void(const uint16_t, const uint8_t)> callback;
+  MidiDmxBridge dut(2, callback.AsStdFunction(), serial);
+
+  EXPECT_CALL(callback, Call(kMaxDmxChannel, 0x04));
+  EXPECT_CALL(callback, Call(0x03, _)).Times(0);
+
+  EXPECT_TRUE(dut.patch(0x01, kMaxDmxChannel, 2));
+  EXPECT_TRUE(dut.patch(0x03, 0x03, 1));
+  dut.listen();
+}
+
+/**
+ * @brief This test case tests whether the function MidiDmxBridge::listen() processes the MIDI CC
+ * messages of all MIDI channels set via MidiDmxBridge::setChannelMask() and applies the DMX channel
+ * offset of each MIDI channel.
+ *
+ */
+TEST(mididmxbridgeListenTestSuite, listen_shall_serve_several_midi_channels) {
+  const std::vector<uint8_t> serialData = {0xb0, 0x01, 0x02, 0xb1, 0x01, 0x04, 0xb2, 0x01, 0x06};
+  NiceMock<SerialReaderMock> serial(serialData);
+  MockFunction<void(const uint16_t, const uint8_t)> callback;
+  MidiDmxBridge dut(1, callback.AsStdFunction(), serial);
+
+  EXPECT_CALL(callback, Call(0x01, 0x04));
+  EXPECT_CALL(callback, Call(0x41, 0x08));
+  EXPECT_CALL(callback, Call(_, 0x0c)).Times(0);
+
+  dut.setChannelMask(0x0003);
+  EXPECT_TRUE(dut.setChannelOffset(2, 0x40));
+  dut.listen();
+}
+
+/**
+ * @brief This test case tests whether the function MidiDmxBridge::listen() advances a crossfade set
+ * via MidiDmxBridge::setFadeTime() with the time of mididmxbridge::IClock::millis().
+ *
+ */
+TEST(mididmxbridgeListenTestSuite, listen_shall_advance_crossfade) {
+  const std::vector<uint8_t> serialData = {};
+  const std::vector<uint16_t> channels{1};
+  NiceMock<SerialReaderMock> serial(serialData);
+  MockFunction<void(const uint16_t, const uint8_t)> callback;
+  MidiDmxBridge dut(1, callback.AsStdFunction(), serial);
+  testing::InSequence seq;
+
+  EXPECT_CALL(serial, millis()).WillOnce(testing::Return(10));
+  EXPECT_CALL(callback, Call(1, 0));
+  EXPECT_CALL(serial, millis()).WillOnce(testing::Return(60));
+  EXPECT_CALL(callback, Call(1, 50));
+  EXPECT_CALL(serial, millis()).WillOnce(testing::Return(110));
+  EXPECT_CALL(callback, Call(1, 100));
+
+  dut.setStaticScene({{1, &channels[0]}, {}, {}}, {100, 0, 0});
+  dut.setFadeTime(100);
+  dut.setIdleSleep(0);
+  dut.switchToStaticScene();
+  dut.listen();
+  dut.listen();
+  dut.listen();
+}
+
+#if MIDIDMXBRIDGE_STATS
+/**
+ * @brief This test case tests whether the function MidiDmxBridge::stats() accounts the decoded
+ * messages, the discarded bytes and the triggered callbacks of the listen() calls.
+ *
+ */
+TEST(mididmxbridgeListenTestSuite, stats_shall_count_messages_and_errors) {
+  const std::vector<uint8_t> serialData = {0x05, 0xb0, 0x01, 0x02, 0x03, 0xb0, 0x04, 0x05, 0x06};
+  NiceMock<SerialReaderMock> serial(serialData);
+  MockFunction<void(const uint16_t, const uint8_t)> callback;
+  MidiDmxBridge dut(1, callback.AsStdFunction(), serial);
+
+  EXPECT_CALL(callback, Call(_, _)).Times(2);
+  EXPECT_CALL(serial, overflow()).WillOnce(testing::Return(true));
+
+  dut.setIdleSleep(0);
+  dut.listen();
+
+  const MidiDmxBridgeStats stats = dut.stats();
+  EXPECT_EQ(stats.messages, 2);
+  EXPECT_EQ(stats.droppedBytes, 2);
+  EXPECT_EQ(stats.resyncs, 1);
+  EXPECT_EQ(stats.overflows, 1);
+  EXPECT_EQ(stats.callbacks, 2);
+  EXPECT_EQ(stats.loops, 1);
+
+  dut.resetStats();
+  EXPECT_EQ(dut.stats().messages, 0);
+  EXPECT_EQ(dut.stats().droppedBytes, 0);
+  EXPECT_EQ(dut.stats().callbacks, 0);
+  EXPECT_EQ(dut.stats().loops, 0);
+}
+
+/**
+ * @brief This test case tests whether the function MidiDmxBridge::stats() reports the maximum and
+ * the moving average of the listen() duration measured via mididmxbridge::IClock::micros().
+ *
+ */
+TEST(mididmxbridgeListenTestSuite, stats_shall_measure_loop_time) {
+  const std::vector<uint8_t> serialData = {};
+  NiceMock<SerialReaderMock> serial(serialData);
+  MockFunction<void(const uint16_t, const uint8_t)> callback;
+  MidiDmxBridge dut(1, callback.AsStdFunction(), serial);
+
+  EXPECT_CALL(serial, micros())
+      .WillOnce(testing::Return(1000))
+      .WillOnce(testing::Return(1080))
+      .WillOnce(testing::Return(2000))
+      .WillOnce(testing::Return(2160));
+
+  dut.setIdleSleep(0);
+  dut.listen();
+  EXPECT_EQ(dut.stats().maxLoopUs, 80);
+  EXPECT_EQ(dut.stats().avgLoopUs, 80);
+
+  dut.listen();
+  EXPECT_EQ(dut.stats().loops, 2);
+  EXPECT_EQ(dut.stats().maxLoopUs, 160);
+  EXPECT_EQ(dut.stats().avgLoopUs, 90);  // (7 * 80 + 160) / 8
+}
+#endif
+
+/**
+ * @brief This test case tests whether the function MidiDmxBridge::listen() converts only the last
+ * value per controller of a batch once coalescing is enabled via MidiDmxBridge::setCoalescing().
+ *
+ */
+TEST(mididmxbridgeListenTestSuite, listen_coalescing_shall_drop_intermediate_values) {
+  const std::vector<uint8_t> serialData = {0xb0, 0x07, 0x10, 0x07, 0x20, 0x08, 0x30, 0x07, 0x40};
+  NiceMock<SerialReaderMock> serial(serialData);
+  MockFunction<void(const uint16_t, const uint8_t)> callback;
+  MidiDmxBridge dut(1, callback.AsStdFunction(), serial);
+  testing::InSequence seq;
+
+  EXPECT_CALL(callback, Call(7, 0x80));
+  EXPECT_CALL(callback, Call(8, 0x60));
+
+  dut.setCoalescing(true);
+  dut.listen();
+}
+
+#if MIDIDMXBRIDGE_USE_HIGH_RES
+/**
+ * @brief This test case tests whether the function MidiDmxBridge::listen() keeps the order of NRPN
+ * messages while coalescing is enabled.
+ *
+ */
+TEST(mididmxbridgeListenTestSuite, listen_coalescing_shall_keep_nrpn_order) {
+  const std::vector<uint8_t> serialData = {0xb0, 0x63, 0x00, 0x62, 0x05, 0x06, 0x40,
+                                           0x63, 0x00, 0x62, 0x06, 0x06, 0x20};
+  NiceMock<SerialReaderMock> serial(serialData);
+  MockFunction<void(const uint16_t, const uint8_t)> callback;
+  MidiDmxBridge dut(1, callback.AsStdFunction(), serial);
+  testing::InSequence seq;
+
+  EXPECT_CALL(callback, Call(5, 128));
+  EXPECT_CALL(callback, Call(6, 64));
+
+  dut.setResolution(DmxResolution::k8Bit);
+  dut.setCoalescing(true);
+  dut.listen();
+}
+#endif
+
+/**
+ * @brief This struct defines a configuration of BasicMidiDmxBridge coalescing MIDI CC messages.
+ *
+ */
+struct CoalescingConfig : public mididmxbridge::DefaultBridgeConfig {
+  static constexpr uint16_t kIdleSleepMs = 0;  /**< never sleep */
+  static constexpr bool kUseCoalescing = true; /**< coalesce redundant MIDI CC messages */
+};
+
+/**
+ * @brief This test case tests whether BasicMidiDmxBridge applies the configuration given as
+ * template parameter with a concrete serial reader type.
+ *
+ */
+TEST(mididmxbridgeListenTestSuite, basicMidiDmxBridge_shall_apply_config) {
+  const std::vector<uint8_t> serialData = {0xb0, 0x07, 0x10, 0x07, 0x20};
+  NiceMock<SerialReaderMock> serial(serialData);
+  MockFunction<void(const uint16_t, const uint8_t)> callback;
+  BasicMidiDmxBridge<NiceMock<SerialReaderMock>, CoalescingConfig> dut(
+      1, callback.AsStdFunction(), serial);
+
+  EXPECT_CALL(callback, Call(7, 0x40));
+  EXPECT_CALL(serial, sleep(_)).Times(0);
+
+  dut.listen();
+}
+
+/**
+ * @brief This test case tests whether the dynamic scene saved lazily by MidiDmxBridge::listen() is
+ * restored and output by MidiDmxBridge::begin() after a power cycle.
+ *
+ */
+TEST(mididmxbridgeListenTestSuite, begin_shall_restore_scenes_saved_by_listen) {
+  const std::vector<uint8_t> serialData = {0xb0, 0x07, 0x20};
+  SceneStoreFake store(Dmx::sceneStoreSize());
+  {
+    NiceMock<SerialReaderMock> serial(serialData);
+    MidiDmxBridge dut(1, nullptr, serial);
+    uint32_t now_ms = 0;
+
+    ON_CALL(serial, millis()).WillByDefault(testing::ReturnPointee(&now_ms));
+    dut.setSceneStore(&store);
+    dut.setIdleSleep(0);
+    dut.begin();
+    dut.listen();
+
+    EXPECT_FALSE(dut.isSceneSaved());
+
+    now_ms = kDefaultSceneSaveDelayMs;
+    while (!dut.isSceneSaved()) {
+      dut.listen();
+    }
+  }
+
+  const std::vector<uint8_t> noData = {};
+  NiceMock<SerialReaderMock> serial(noData);
+  MockFunction<void(const uint16_t, const uint8_t)> callback;
+  MidiDmxBridge dut(1, callback.AsStdFunction(), serial);
+
+  EXPECT_CALL(callback, Call(7, 0x40));
+
+  dut.setSceneStore(&store);
+  dut.begin();
+}
+
+#if MIDIDMXBRIDGE_USE_FRAME_MODE
+/**
+ * @brief This test case tests whether MidiDmxBridge::poll() collects the DMX changes and outputs
+ * them once per frame without sleeping.
+ *
+ */
+TEST(mididmxbridgeListenTestSuite, poll_shall_output_at_frame_rate) {
+  const std::vector<uint8_t> serialData = {0xb0, 0x07, 0x20, 0x07, 0x30};
+  NiceMock<SerialReaderMock> serial(serialData);
+  MockFunction<void(const uint16_t, const uint8_t)> callback;
+  MidiDmxBridge dut(1, callback.AsStdFunction(), serial);
+  uint32_t now_us = 0;
+
+  ON_CALL(serial, micros()).WillByDefault(testing::ReturnPointee(&now_us));
+  EXPECT_CALL(serial, sleep(_)).Times(0);
+
+  EXPECT_CALL(callback, Call(_, _)).Times(0);
+  dut.poll();
+  now_us = 1000000 / kDefaultFrameRate - 1;
+  dut.poll();
+  testing::Mock::VerifyAndClearExpectations(&callback);
+
+  EXPECT_CALL(callback, Call(7, 0x60));
+  now_us++;
+  dut.poll();
+  dut.poll();
+}
+
+/**
+ * @brief This test case tests whether MidiDmxBridge::poll() keeps the frame rate exact and drops
+ * the frames missed by a stalled loop.
+ *
+ */
+TEST(mididmxbridgeListenTestSuite, poll_shall_drop_missed_frames) {
+  const std::vector<uint8_t> serialData = {};
+  NiceMock<SerialReaderMock> serial(serialData);
+  MidiDmxBridge dut(1, nullptr, serial);
+  uint32_t now_us = 0;
+  size_t frames = 0;
+
+  ON_CALL(serial, micros()).WillByDefault(testing::ReturnPointee(&now_us));
+  ON_CALL(serial, millis()).WillByDefault(testing::Invoke([&frames]() {
+    frames++;  // every frame advances the time-based DMX tasks
+    return 0;
+  }));
+  dut.setFrameRate(100);
+
+  for (now_us = 0; now_us <= 100000; now_us += 3000) {
+    dut.poll();
+  }
+  EXPECT_EQ(frames, 9);  // the frames of 10 ms to 90 ms, each output up to 2 ms late
+
+  now_us = 155000;
+  dut.poll();
+  now_us = 164999;
+  dut.poll();
+  now_us = 165000;
+  dut.poll();
+  EXPECT_EQ(frames, 11);
+}
+
+/**
+ * @brief This test case tests whether MidiDmxBridge::poll() outputs a frame per call with a frame
+ * rate of 0.
+ *
+ */
+TEST(mididmxbridgeListenTestSuite, poll_shall_output_every_call_without_frame_rate) {
+  const std::vector<uint8_t> serialData = {0xb0, 0x07, 0x20};
+  NiceMock<SerialReaderMock> serial(serialData);
+  MockFunction<void(const uint16_t, const uint8_t)> callback;
+  MidiDmxBridge dut(1, callback.AsStdFunction(), serial);
+
+  EXPECT_CALL(callback, Call(7, 0x40));
+
+  dut.setFrameRate(0);
+  dut.poll();
 }
+#endif
 }  // namespace mididmxbridge::unittest
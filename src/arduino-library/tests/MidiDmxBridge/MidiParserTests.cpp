@@ -0,0 +1,151 @@
+/**
+ * @file MidiParserTests.cpp
+ * @author Christian Neukam
+ * @brief Unit Tests for the mididmxbridge::midi::MidiParser class
+ * @version 1.0
+ * @date 2024-02-03
+ *
+ * @copyright Copyright 2024 Christian Neukam. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "MidiParser.h"
+
+namespace mididmxbridge::unittest {
+using mididmxbridge::midi::MidiMessage;
+using mididmxbridge::midi::MidiParser;
+
+/**
+ * @brief Feed a byte stream into the parser and collect all decoded messages.
+ *
+ * @param[in] dut the parser to feed
+ * @param[in] data the MIDI byte stream
+ * @return std::vector<MidiMessage> - the decoded messages
+ */
+static std::vector<MidiMessage> parseAll(MidiParser& dut, const std::vector<uint8_t>& data) {
+  std::vector<MidiMessage> messages;
+  MidiMessage message = {0, 0, 0};
+
+  for (const auto byte : data) {
+    if (dut.parse(byte, message)) {
+      messages.push_back(message);
+    }
+  }
+
+  return messages;
+}
+
+/**
+ * @brief This test case tests whether the function mididmxbridge::midi::MidiParser::parse() decodes
+ * a complete MIDI CC message with its last byte.
+ *
+ */
+TEST(MidiParserTestSuite, parse_completeMessage_shall_pass) {
+  MidiParser dut;
+  MidiMessage message = {0, 0, 0};
+
+  EXPECT_FALSE(dut.parse(0xb3, message));
+  EXPECT_FALSE(dut.parse(0x01, message));
+  ASSERT_TRUE(dut.parse(0x02, message));
+  EXPECT_EQ(message.status, 0xb3);
+  EXPECT_EQ(message.data1, 0x01);
+  EXPECT_EQ(message.data2, 0x02);
+}
+
+/**
+ * @brief This test case tests whether the function mididmxbridge::midi::MidiParser::parse() decodes
+ * each byte of a stream exactly once, independent of how the stream is split into chunks.
+ *
+ */
+TEST(MidiParserTestSuite, parse_splitStream_shall_decode_all_messages) {
+  const std::vector<uint8_t> stream = {0xb0, 0x01, 0x02, 0x03, 0xf8, 0x04, 0xc0, 0x05, 0xb0, 0x06};
+  const std::vector<uint8_t> tail = {0x07};
+  MidiParser dut;
+
+  const auto first = parseAll(dut, stream);
+  const auto second = parseAll(dut, tail);
+
+  ASSERT_EQ(first.size(), 3u);
+  EXPECT_EQ(first[0].data1, 0x01);
+  EXPECT_EQ(first[1].data1, 0x03);
+  EXPECT_EQ(first[1].data2, 0x04);
+  EXPECT_EQ(first[2].status, 0xc0);
+  EXPECT_EQ(first[2].data1, 0x05);
+  EXPECT_EQ(first[2].data2, 0x00);
+  ASSERT_EQ(second.size(), 1u);
+  EXPECT_EQ(second[0].status, 0xb0);
+  EXPECT_EQ(second[0].data1, 0x06);
+  EXPECT_EQ(second[0].data2, 0x07);
+}
+
+/**
+ * @brief This test case tests whether the function mididmxbridge::midi::MidiParser::parse() ignores
+ * data bytes without a running status.
+ *
+ */
+TEST(MidiParserTestSuite, parse_dataWithoutStatus_shall_fail) {
+  MidiParser dut;
+
+  EXPECT_TRUE(parseAll(dut, {0x01, 0x02, 0x03}).empty());
+}
+
+/**
+ * @brief This test case tests whether the function mididmxbridge::midi::MidiParser::reset()
+ * discards the running status and the partially received message.
+ *
+ */
+TEST(MidiParserTestSuite, reset_shall_discard_partial_message) {
+  MidiParser dut;
+
+  EXPECT_TRUE(parseAll(dut, {0xb0, 0x01}).empty());
+  dut.reset();
+  EXPECT_TRUE(parseAll(dut, {0x02, 0x03}).empty());
+}
+
+#if MIDIDMXBRIDGE_STATS
+/**
+ * @brief This test case tests whether the function mididmxbridge::midi::MidiParser::droppedBytes()
+ * counts data bytes received without running status.
+ *
+ */
+TEST(MidiParserTestSuite, droppedBytes_dataWithoutStatus_shall_be_counted) {
+  MidiParser dut;
+
+  parseAll(dut, {0x01, 0x02, 0xf0, 0x7e, 0x7f, 0xf7, 0xf8});
+  EXPECT_EQ(dut.droppedBytes(), 4);
+  EXPECT_EQ(dut.resyncs(), 0);
+}
+
+/**
+ * @brief This test case tests whether the function mididmxbridge::midi::MidiParser::resyncs()
+ * counts partially received messages aborted by a status byte.
+ *
+ */
+TEST(MidiParserTestSuite, resyncs_abortedMessage_shall_be_counted) {
+  MidiParser dut;
+
+  EXPECT_EQ(parseAll(dut, {0xb0, 0x01, 0xb0, 0x02, 0x03, 0x04, 0xf0}).size(), 1);
+  EXPECT_EQ(dut.droppedBytes(), 2);
+  EXPECT_EQ(dut.resyncs(), 2);
+
+  dut.resetStats();
+  EXPECT_EQ(dut.droppedBytes(), 0);
+  EXPECT_EQ(dut.resyncs(), 0);
+}
+#endif
+}  // namespace mididmxbridge::unittest
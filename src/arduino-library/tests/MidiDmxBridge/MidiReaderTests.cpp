@@ -257,6 +257,148 @@ TEST_P(MidiReaderCcDataByteTestSuite, readCc_valueByte_shall_getUpdated_if_valid
   }
 }
 
+/**
+ * @brief This test case tests whether the function mididmxbridge::midi::MidiReader::readCc() reads
+ * MIDI CC data sent with running status, i.e. without repeated sync bytes.
+ *
+ */
+TEST_F(MidiReaderTestSuite, readCc_runningStatus_shall_pass) {
+  uint8_t controller;
+  uint8_t value;
+  const std::vector<uint8_t> serialData = {mSyncByte, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06};
+
+  NiceMock<SerialReaderMock> serial(serialData);
+  MidiReader dut{mChannel, serial};
+
+  for (uint8_t idx = 1; idx < serialData.size(); idx += 2) {
+    ASSERT_TRUE(dut.readCc(controller, value));
+    EXPECT_EQ(controller, serialData[idx]);
+    EXPECT_EQ(value, serialData[idx + 1]);
+  }
+  EXPECT_FALSE(dut.readCc(controller, value));
+}
+
+/**
+ * @brief This test case tests whether the function mididmxbridge::midi::MidiReader::readCc()
+ * ignores system realtime bytes received in between the bytes of a MIDI CC datum.
+ *
+ */
+TEST_F(MidiReaderTestSuite, readCc_realtimeBytes_shall_beIgnored) {
+  uint8_t controller;
+  uint8_t value;
+  const std::vector<uint8_t> serialData = {0xf8, mSyncByte, 0xf8, 0x01, 0xfe, 0x02, 0xff};
+
+  NiceMock<SerialReaderMock> serial(serialData);
+  MidiReader dut{mChannel, serial};
+
+  ASSERT_TRUE(dut.readCc(controller, value));
+  EXPECT_EQ(controller, 0x01);
+  EXPECT_EQ(value, 0x02);
+}
+
+/**
+ * @brief This test case tests whether the function mididmxbridge::midi::MidiReader::readCc()
+ * ignores running status data of other MIDI messages, including messages with only one data byte.
+ *
+ */
+TEST_F(MidiReaderTestSuite, readCc_otherMessages_shall_beIgnored) {
+  uint8_t controller;
+  uint8_t value;
+  const std::vector<uint8_t> serialData = {0x90, 0x10, 0x20, 0x11, 0x21, 0xc0, 0x01, 0x02,
+                                           0x03, mSyncByte, 0x04, 0x05};
+
+  NiceMock<SerialReaderMock> serial(serialData);
+  MidiReader dut{mChannel, serial};
+
+  ASSERT_TRUE(dut.readCc(controller, value));
+  EXPECT_EQ(controller, 0x04);
+  EXPECT_EQ(value, 0x05);
+}
+
+/**
+ * @brief This test case tests whether the function mididmxbridge::midi::MidiReader::readCc()
+ * clears the running status on system exclusive and system common messages.
+ *
+ */
+TEST_F(MidiReaderTestSuite, readCc_systemMessages_shall_clearRunningStatus) {
+  uint8_t controller;
+  uint8_t value;
+  const std::vector<uint8_t> serialData = {mSyncByte, 0x01, 0x02, 0xf0, 0x03,
+                                           0x04,      0xf7, 0x05, 0x06};
+
+  NiceMock<SerialReaderMock> serial(serialData);
+  MidiReader dut{mChannel, serial};
+
+  EXPECT_TRUE(dut.readCc(controller, value));
+  EXPECT_FALSE(dut.readCc(controller, value));
+}
+
+/**
+ * @brief This test case tests whether the function mididmxbridge::midi::MidiReader::readCc()
+ * completes a MIDI CC datum that is split across several calls.
+ *
+ */
+TEST_F(MidiReaderTestSuite, readCc_splitMessage_shall_pass) {
+  uint8_t controller;
+  uint8_t value;
+  const std::vector<uint8_t> serialData = {mSyncByte};
+
+  NiceMock<SerialReaderMock> serial(serialData);
+  MidiReader dut{mChannel, serial};
+
+  EXPECT_FALSE(dut.readCc(controller, value));
+  serial.append({0x01});
+  EXPECT_FALSE(dut.readCc(controller, value));
+  serial.append({0x02});
+  ASSERT_TRUE(dut.readCc(controller, value));
+  EXPECT_EQ(controller, 0x01);
+  EXPECT_EQ(value, 0x02);
+}
+
+/**
+ * @brief This test case tests whether the function mididmxbridge::midi::MidiReader::readCc()
+ * fetches the serial data in bursts via mididmxbridge::ISerialReader::readBytes() instead of byte
+ * by byte.
+ *
+ */
+TEST_F(MidiReaderTestSuite, readCc_shall_use_bulk_read) {
+  using testing::_;
+  uint8_t controller;
+  uint8_t value;
+  const std::vector<uint8_t> serialData = {mSyncByte, 0x01, 0x02, 0x03, 0x04};
+
+  NiceMock<SerialReaderMock> serial(serialData);
+  MidiReader dut{mChannel, serial};
+
+  EXPECT_CALL(serial, read()).Times(0);
+  EXPECT_CALL(serial, readBytes(_, _)).Times(1);
+
+  EXPECT_TRUE(dut.readCc(controller, value));
+  EXPECT_TRUE(dut.readCc(controller, value));
+  EXPECT_EQ(controller, 0x03);
+  EXPECT_EQ(value, 0x04);
+}
+
+/**
+ * @brief This test case tests whether the function
+ * mididmxbridge::midi::MidiReader::hasPendingData() reports the remaining serial data.
+ *
+ */
+TEST_F(MidiReaderTestSuite, hasPendingData_reports_remaining_data) {
+  uint8_t controller;
+  uint8_t value;
+  const std::vector<uint8_t> serialData = {mSyncByte, 0x01, 0x02, mSyncByte};
+
+  NiceMock<SerialReaderMock> serial(serialData);
+  MidiReader dut{mChannel, serial};
+
+  EXPECT_TRUE(dut.hasPendingData());
+  EXPECT_TRUE(dut.readCc(controller, value));
+  EXPECT_TRUE(dut.hasPendingData());
+  EXPECT_FALSE(dut.readCc(controller, value));
+  EXPECT_FALSE(dut.hasPendingData());
+}
+
 /**
  * @brief This test case tests whether the function mididmxbridge::midi::MidiReader::begin() calls
  * mididmxbridge::ISerialReader::begin().
@@ -269,4 +411,31 @@ TEST_F(MidiReaderTestSuite, begin_calls_serial_begin) {
   EXPECT_CALL(serial, begin());
   dut.begin();
 }
+
+/**
+ * @brief This test case tests whether the function mididmxbridge::midi::MidiReader::readCc()
+ * returns the MIDI CC messages of all MIDI channels enabled via
+ * mididmxbridge::midi::MidiReader::setChannelMask() together with their MIDI channel.
+ *
+ */
+TEST_F(MidiReaderTestSuite, readCc_channelMask_shall_pass) {
+  uint8_t controller;
+  uint8_t value;
+  uint8_t channel;
+  const std::vector<uint8_t> serialData = {0xb0, 0x01, 0x02, 0xb1, 0x03, 0x04,
+                                           0xbf, 0x05, 0x06, 0xb2, 0x07, 0x08};
+
+  NiceMock<SerialReaderMock> serial(serialData);
+  MidiReader dut{mChannel, serial};
+  dut.setChannelMask(0x8002);
+
+  EXPECT_EQ(dut.channelMask(), 0x8002);
+  EXPECT_TRUE(dut.readCc(controller, value, channel));
+  EXPECT_EQ(controller, 0x03);
+  EXPECT_EQ(channel, 2);
+  EXPECT_TRUE(dut.readCc(controller, value, channel));
+  EXPECT_EQ(controller, 0x05);
+  EXPECT_EQ(channel, 16);
+  EXPECT_FALSE(dut.readCc(controller, value, channel));
+}
 }  // namespace mididmxbridge::unittest
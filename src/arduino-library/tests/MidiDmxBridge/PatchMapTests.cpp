@@ -0,0 +1,99 @@
+/**
+ * @file PatchMapTests.cpp
+ * @author Christian Neukam
+ * @brief Unit Tests for the mididmxbridge::dmx::PatchMap class.
+ * @version 1.0
+ * @date 2024-02-27
+ *
+ * @copyright Copyright 2024 Christian Neukam. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "PatchMap.h"
+
+namespace mididmxbridge::unittest {
+using mididmxbridge::dmx::PatchMap;
+
+/**
+ * @brief This test case tests whether a default constructed mididmxbridge::dmx::PatchMap is empty.
+ *
+ */
+TEST(PatchMapTestSuite, construct_empty) {
+  PatchMap map;
+
+  EXPECT_TRUE(map.empty());
+  EXPECT_EQ(map.size(), 0);
+  EXPECT_EQ(map.find(0, 0, 0), map.size());
+}
+
+/**
+ * @brief This test case tests whether mididmxbridge::dmx::PatchMap::add() rejects parameters out of
+ * range and does not duplicate existing patches.
+ *
+ */
+TEST(PatchMapTestSuite, add_validates_parameters) {
+  PatchMap map;
+
+  EXPECT_FALSE(map.add(kMaxMidiValue + 1, 1, 0));
+  EXPECT_FALSE(map.add(1, 0, 0));
+  EXPECT_FALSE(map.add(1, kMaxDmxChannel + 1, 0));
+  EXPECT_FALSE(map.add(1, 1, 17));
+  EXPECT_TRUE(map.empty());
+
+  EXPECT_TRUE(map.add(1, kMaxDmxChannel, 16));
+  EXPECT_TRUE(map.add(1, kMaxDmxChannel, 16));
+  EXPECT_EQ(map.size(), 1);
+}
+
+/**
+ * @brief This test case tests whether mididmxbridge::dmx::PatchMap::add() fails once the capacity
+ * is exhausted.
+ *
+ */
+TEST(PatchMapTestSuite, add_fails_if_full) {
+  PatchMap map;
+
+  for (uint8_t idx = 0; idx < kMaxPatches; idx++) {
+    EXPECT_TRUE(map.add(idx, 1, 0));
+  }
+
+  EXPECT_FALSE(map.add(kMaxPatches, 1, 0));
+  EXPECT_EQ(map.size(), kMaxPatches);
+}
+
+/**
+ * @brief This test case tests whether mididmxbridge::dmx::PatchMap::find() iterates all patches of
+ * a controller and respects the MIDI channel.
+ *
+ */
+TEST(PatchMapTestSuite, find_matches_controller_and_midi_channel) {
+  PatchMap map;
+  std::vector<uint16_t> addresses;
+
+  map.add(1, 10, 0);
+  map.add(2, 20, 0);
+  map.add(1, 30, 2);
+  map.add(1, 40, 3);
+
+  for (uint8_t idx = map.find(1, 2, 0); idx < map.size(); idx = map.find(1, 2, idx + 1)) {
+    addresses.push_back(map.address(idx));
+  }
+  EXPECT_THAT(addresses, testing::ElementsAre(10, 30));
+
+  map.clear();
+  EXPECT_TRUE(map.empty());
+}
+}  // namespace mididmxbridge::unittest
@@ -0,0 +1,103 @@
+/**
+ * @file ResponseCurveTests.cpp
+ * @author Christian Neukam
+ * @brief Unit Tests for the response curves of the mididmxbridge::dmx namespace.
+ * @version 1.0
+ * @date 2024-03-13
+ *
+ * @copyright Copyright 2024 Christian Neukam. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <cmath>
+
+#include "ResponseCurve.h"
+
+namespace mididmxbridge::unittest {
+using namespace mididmxbridge::dmx;
+
+static_assert(GammaCurve<22>::value(0) == 0, "the gamma curve shall start at 0");
+static_assert(GammaCurve<22>::value(kCurveSize - 1) == kMaxCurveValue,
+              "the gamma curve shall end at the maximum DMX value");
+static_assert(SCurve::value(0) == 0, "the S-curve shall start at 0");
+static_assert(SCurve::value(kCurveSize - 1) == kMaxCurveValue,
+              "the S-curve shall end at the maximum DMX value");
+
+/**
+ * @brief This test case checks whether the linear curve passes all DMX values unchanged.
+ *
+ */
+TEST(ResponseCurveTestSuite, linear_curve_passes_values) {
+  for (uint16_t value = 0; value <= 255; value++) {
+    EXPECT_EQ(applyCurve(DmxCurve::kLinear, (uint8_t)value), value);
+  }
+}
+
+/**
+ * @brief This test case checks whether the compile-time gamma table equals the gamma curve
+ * evaluated at runtime via std::pow().
+ *
+ */
+TEST(ResponseCurveTestSuite, gamma_curve_equals_std_pow) {
+  for (uint8_t idx = 0; idx < kCurveSize; idx++) {
+    const double expected = std::round(kMaxCurveValue * std::pow(idx / 127.0, 2.2));
+
+    EXPECT_EQ(applyCurve(DmxCurve::kGamma, (uint8_t)(idx << 1)), expected);
+  }
+}
+
+/**
+ * @brief This test case checks whether the compile-time S-curve table equals the smoothstep
+ * function evaluated at runtime.
+ *
+ */
+TEST(ResponseCurveTestSuite, s_curve_equals_smoothstep) {
+  for (uint8_t idx = 0; idx < kCurveSize; idx++) {
+    const double x = idx / 127.0;
+    const double expected = std::round(kMaxCurveValue * x * x * (3.0 - 2.0 * x));
+
+    EXPECT_EQ(applyCurve(DmxCurve::kSCurve, (uint8_t)(idx << 1)), expected);
+  }
+}
+
+/**
+ * @brief This test case checks whether all curves are monotonic and odd DMX values are
+ * interpolated between the neighboring entries.
+ *
+ */
+TEST(ResponseCurveTestSuite, curves_are_monotonic_and_interpolated) {
+  for (const DmxCurve curve : {DmxCurve::kLinear, DmxCurve::kGamma, DmxCurve::kSCurve}) {
+    for (uint8_t value = 1; value < 254; value += 2) {
+      const uint8_t lower = applyCurve(curve, value - 1);
+      const uint8_t upper = applyCurve(curve, value + 1);
+
+      EXPECT_GE(applyCurve(curve, value), lower);
+      EXPECT_LE(applyCurve(curve, value), upper);
+      EXPECT_EQ(applyCurve(curve, value), (lower + upper + 1) / 2);
+    }
+  }
+}
+
+/**
+ * @brief This test case checks whether all curves map the full-scale DMX value 255 to itself.
+ *
+ */
+TEST(ResponseCurveTestSuite, curves_keep_full_scale) {
+  for (const DmxCurve curve : {DmxCurve::kLinear, DmxCurve::kGamma, DmxCurve::kSCurve}) {
+    EXPECT_EQ(applyCurve(curve, 255), 255) << "curve " << (int)curve;
+  }
+}
+}  // namespace mididmxbridge::unittest
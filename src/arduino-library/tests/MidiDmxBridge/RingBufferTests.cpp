@@ -0,0 +1,123 @@
+/**
+ * @file RingBufferTests.cpp
+ * @author Christian Neukam
+ * @brief Unit Tests for the mididmxbridge::RingBuffer class template.
+ * @version 1.0
+ * @date 2024-02-10
+ *
+ * @copyright Copyright 2024 Christian Neukam. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "RingBuffer.h"
+
+namespace mididmxbridge::unittest {
+using mididmxbridge::RingBuffer;
+
+/**
+ * @brief This test case tests whether a default constructed mididmxbridge::RingBuffer is empty.
+ *
+ */
+TEST(RingBufferTestSuite, construct_empty) {
+  RingBuffer<uint8_t, 8> buffer;
+
+  EXPECT_TRUE(buffer.empty());
+  EXPECT_EQ(buffer.size(), 0);
+  EXPECT_EQ(buffer.capacity(), 7);
+  EXPECT_EQ(buffer.dropped(), 0);
+}
+
+/**
+ * @brief This test case tests whether the elements of a mididmxbridge::RingBuffer are removed in
+ * the order they were appended.
+ *
+ */
+TEST(RingBufferTestSuite, push_pop_fifo_order) {
+  RingBuffer<uint8_t, 8> buffer;
+  uint8_t value = 0;
+
+  EXPECT_TRUE(buffer.push(1));
+  EXPECT_TRUE(buffer.push(2));
+  EXPECT_EQ(buffer.size(), 2);
+
+  EXPECT_TRUE(buffer.pop(value));
+  EXPECT_EQ(value, 1);
+  EXPECT_TRUE(buffer.pop(value));
+  EXPECT_EQ(value, 2);
+  EXPECT_FALSE(buffer.pop(value));
+  EXPECT_TRUE(buffer.empty());
+}
+
+/**
+ * @brief This test case tests whether a full mididmxbridge::RingBuffer discards new elements and
+ * counts them.
+ *
+ */
+TEST(RingBufferTestSuite, push_full_shall_drop) {
+  RingBuffer<uint8_t, 4> buffer;
+  uint8_t value = 0;
+
+  for (uint8_t idx = 0; idx < buffer.capacity(); idx++) {
+    EXPECT_TRUE(buffer.push(idx));
+  }
+
+  EXPECT_FALSE(buffer.push(0xff));
+  EXPECT_EQ(buffer.size(), buffer.capacity());
+  EXPECT_EQ(buffer.dropped(), 1);
+
+  EXPECT_TRUE(buffer.pop(value));
+  EXPECT_EQ(value, 0);
+}
+
+/**
+ * @brief This test case tests whether the bulk removal of a mididmxbridge::RingBuffer transfers the
+ * elements in order across the wrap-around of the indices.
+ *
+ */
+TEST(RingBufferTestSuite, pop_bulk_wraps_around) {
+  RingBuffer<uint8_t, 4> buffer;
+  uint8_t data[4] = {};
+
+  for (uint8_t round = 0; round < 5; round++) {
+    EXPECT_TRUE(buffer.push(round));
+    EXPECT_TRUE(buffer.push(round + 1));
+    EXPECT_TRUE(buffer.push(round + 2));
+
+    EXPECT_EQ(buffer.pop(data, 2), 2u);
+    EXPECT_EQ(data[0], round);
+    EXPECT_EQ(data[1], round + 1);
+    EXPECT_EQ(buffer.pop(data, sizeof(data)), 1u);
+    EXPECT_EQ(data[0], round + 2);
+    EXPECT_TRUE(buffer.empty());
+  }
+}
+
+/**
+ * @brief This test case tests whether a mididmxbridge::RingBuffer with 256 elements uses the full
+ * 8-bit index range.
+ *
+ */
+TEST(RingBufferTestSuite, max_size_buffer) {
+  RingBuffer<uint8_t, 256> buffer;
+
+  for (uint16_t idx = 0; idx < 255; idx++) {
+    EXPECT_TRUE(buffer.push((uint8_t)idx));
+  }
+
+  EXPECT_FALSE(buffer.push(0));
+  EXPECT_EQ(buffer.size(), 255);
+}
+}  // namespace mididmxbridge::unittest
@@ -0,0 +1,325 @@
+/**
+ * @file SceneBankTests.cpp
+ * @author Christian Neukam
+ * @brief Unit Tests for the mididmxbridge::dmx::SceneBank class template.
+ * @version 1.0
+ * @date 2024-03-12
+ *
+ * @copyright Copyright 2024 Christian Neukam. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "DenseScene.h"
+#include "SceneBank.h"
+#include "SceneStoreFake.h"
+
+namespace mididmxbridge::unittest {
+using mididmxbridge::dmx::DenseScene;
+using mididmxbridge::dmx::kSceneBankHeaderSize;
+using mididmxbridge::dmx::SceneBank;
+
+using Scene = DenseScene<16>;     /**< the scene type to persist */
+using Bank = SceneBank<Scene, 2>; /**< the scene bank under test */
+
+/**
+ * @brief This class provides the fixture for the Test Suite, which checks the SceneBank class
+ * template.
+ *
+ */
+class SceneBankTestSuite : public testing::Test {
+ public:
+  /**
+   * @brief Construct a new SceneBankTestSuite object.
+   *
+   */
+  SceneBankTestSuite() : mStore(64), mScenes(), mDut() {
+    mDut.attach(0, mScenes[0]);
+    mDut.attach(1, mScenes[1]);
+    mDut.setStore(&mStore);
+    mDut.setSaveDelay(100);
+  }
+
+ protected:
+  /**
+   * @brief Call persist() until the running save is completed.
+   *
+   * @param[in] now_ms the time passed to persist()
+   * @return size_t - the number of persist() calls
+   */
+  size_t persistAll(const uint32_t now_ms) {
+    size_t calls = 0;
+
+    do {
+      mDut.persist(now_ms);
+      calls++;
+    } while (!mDut.isSaved() && (calls < 1000));
+
+    return calls;
+  }
+
+  /**
+   * @brief Flag the scenes as changed and save them once the save delay elapsed.
+   *
+   * @param[in] now_ms the time of the change
+   * @return size_t - the number of persist() calls after the save delay
+   */
+  size_t save(const uint32_t now_ms) {
+    mDut.markChanged();
+    mDut.persist(now_ms);
+
+    return persistAll(now_ms + 100);
+  }
+
+  SceneStoreFake mStore; /**< the simulated EEPROM */
+  Scene mScenes[2];      /**< the scenes to persist */
+  Bank mDut;             /**< the device under test */
+};
+
+/**
+ * @brief This test case tests whether an erased store is not restored.
+ *
+ */
+TEST_F(SceneBankTestSuite, restore_shall_reject_erased_store) {
+  EXPECT_FALSE(mDut.restore());
+  EXPECT_FALSE(mScenes[0].isSet(0));
+}
+
+/**
+ * @brief This test case tests whether a store too small for the scene bank is neither restored
+ * nor written.
+ *
+ */
+TEST(SceneBankSmallStoreTestSuite, small_store_shall_not_be_used) {
+  SceneStoreFake store(Bank::size() - 1);
+  Scene scenes[2];
+  Bank dut;
+
+  dut.attach(0, scenes[0]);
+  dut.attach(1, scenes[1]);
+  scenes[1].set(15, 20);
+
+  EXPECT_FALSE(dut.setStore(&store));
+  EXPECT_FALSE(dut.restore());
+
+  dut.markChanged();
+  for (uint32_t now_ms = 0; now_ms < 10 * kDefaultSceneSaveDelayMs; now_ms += 100) {
+    dut.persist(now_ms);  // would overflow the store if it was used
+  }
+  EXPECT_EQ(store.writes(), 0);
+  EXPECT_TRUE(dut.setStore(nullptr));
+}
+
+/**
+ * @brief This test case tests whether saved scenes are restored with one sequential read per
+ * scene.
+ *
+ */
+TEST_F(SceneBankTestSuite, persist_and_restore_shall_roundtrip) {
+  mScenes[0].set(1, 10);
+  mScenes[1].set(15, 20);
+  save(0);
+
+  Scene restored[2];
+  Bank bank;
+  bank.attach(0, restored[0]);
+  bank.attach(1, restored[1]);
+  bank.setStore(&mStore);
+
+  EXPECT_TRUE(bank.restore());
+  EXPECT_EQ(restored[0].value(1), 10);
+  EXPECT_TRUE(restored[1].isSet(15));
+  EXPECT_EQ(restored[1].value(15), 20);
+  EXPECT_FALSE(restored[1].isSet(1));
+  EXPECT_EQ(mStore.reads(), 3);  // header and both scenes
+}
+
+/**
+ * @brief This test case tests whether a scene bank with a corrupted scene byte, e.g. of a worn
+ * EEPROM cell, is not restored and leaves the scenes unchanged.
+ *
+ */
+TEST_F(SceneBankTestSuite, restore_shall_reject_corrupted_scene_byte) {
+  mScenes[0].set(1, 10);
+  mScenes[1].set(15, 20);
+  save(0);
+
+  Scene restored[2];
+  Bank bank;
+  bank.attach(0, restored[0]);
+  bank.attach(1, restored[1]);
+  bank.setStore(&mStore);
+
+  mStore.data()[kSceneBankHeaderSize + 1] ^= 0x04;
+
+  EXPECT_FALSE(bank.restore());
+  EXPECT_FALSE(restored[0].isSet(1));
+  EXPECT_FALSE(restored[1].isSet(15));
+
+  mStore.data()[kSceneBankHeaderSize + 1] ^= 0x04;
+
+  EXPECT_TRUE(bank.restore());
+  EXPECT_EQ(restored[0].value(1), 10);
+}
+
+/**
+ * @brief This test case tests whether the save waits until the scenes have not changed for the
+ * save delay.
+ *
+ */
+TEST_F(SceneBankTestSuite, persist_shall_wait_for_save_delay) {
+  mScenes[0].set(1, 10);
+  mDut.markChanged();
+  mDut.persist(0);
+  mDut.persist(50);
+  mDut.markChanged();  // restarts the save delay
+  mDut.persist(99);
+  mDut.persist(198);
+
+  EXPECT_EQ(mStore.writes(), 0);
+  EXPECT_FALSE(mDut.isSaved());
+
+  mDut.persist(199);
+  EXPECT_EQ(mStore.writes(), 1);
+}
+
+/**
+ * @brief This test case tests whether at most one byte is written per persist() call and the
+ * header is written last.
+ *
+ */
+TEST_F(SceneBankTestSuite, persist_shall_write_one_byte_per_call_and_header_last) {
+  const size_t calls = save(0);
+
+  EXPECT_EQ(mStore.writes(), Bank::size());  // every byte differs from the erased store
+  EXPECT_EQ(calls, Bank::size());
+  EXPECT_EQ(mStore.data()[0], 0x44);
+  EXPECT_EQ(mStore.data()[1], 0x4d);
+}
+
+/**
+ * @brief This test case tests whether an interrupted first save is not restored.
+ *
+ */
+TEST_F(SceneBankTestSuite, interrupted_first_save_shall_not_be_restored) {
+  mScenes[0].set(1, 10);
+  mDut.markChanged();
+  mDut.persist(0);
+
+  for (uint16_t idx = 0; idx < Bank::size() / 2; idx++) {
+    mDut.persist(100);
+  }
+
+  EXPECT_FALSE(mDut.restore());
+}
+
+/**
+ * @brief This test case tests whether saving unchanged scenes again writes only the changed bytes.
+ *
+ */
+TEST_F(SceneBankTestSuite, persist_shall_write_only_changed_bytes) {
+  mScenes[0].set(1, 10);
+  save(0);
+  const size_t writes = mStore.writes();
+
+  mScenes[0].set(1, 11);
+  const size_t calls = save(200);
+
+  EXPECT_EQ(mStore.writes(), writes + 4);  // the scene byte, the invalidated header and the CRC
+  EXPECT_LE(calls, 4 + Bank::size() / kSceneSaveBudget);
+}
+
+/**
+ * @brief This test case tests whether saving unchanged scenes writes nothing, i.e. not even the
+ * header.
+ *
+ */
+TEST_F(SceneBankTestSuite, persist_unchanged_scenes_shall_not_write) {
+  mScenes[0].set(1, 10);
+  save(0);
+  const size_t writes = mStore.writes();
+
+  save(200);
+
+  EXPECT_EQ(mStore.writes(), writes);
+}
+
+/**
+ * @brief This test case tests whether a save interrupted after a valid scene bank got saved
+ * restores no scenes rather than a mix of the old and the new scenes, and whether the completed
+ * save is restored.
+ *
+ */
+TEST_F(SceneBankTestSuite, interrupted_save_shall_not_restore_torn_scenes) {
+  for (uint16_t ch = 0; ch < 16; ch++) {
+    mScenes[0].set(ch, 10);
+    mScenes[1].set(ch, 10);
+  }
+  save(0);
+
+  for (uint16_t ch = 0; ch < 16; ch++) {
+    mScenes[0].set(ch, 20);
+    mScenes[1].set(ch, 20);
+  }
+  mDut.markChanged();
+  mDut.persist(200);
+
+  for (uint16_t write = 0; write < 8; write++) {
+    mDut.persist(300);  // a reset after some of the new scene bytes got written
+  }
+
+  Scene restored[2];
+  Bank bank;
+  bank.attach(0, restored[0]);
+  bank.attach(1, restored[1]);
+  bank.setStore(&mStore);
+
+  EXPECT_FALSE(bank.restore());
+  EXPECT_FALSE(restored[0].isSet(0));
+
+  persistAll(300);
+
+  EXPECT_TRUE(bank.restore());
+  EXPECT_EQ(restored[0].value(0), 20);
+  EXPECT_EQ(restored[1].value(15), 20);
+}
+
+/**
+ * @brief This test case tests whether changes during a running save are saved by another save.
+ *
+ */
+TEST_F(SceneBankTestSuite, change_during_save_shall_be_saved) {
+  save(0);
+
+  mScenes[1].set(15, 30);
+  mDut.markChanged();
+  mDut.persist(200);
+  mDut.persist(300);  // the save starts
+  mScenes[0].set(0, 5);
+  mDut.markChanged();
+  persistAll(300);
+  persistAll(400);
+
+  Scene restored[2];
+  Bank bank;
+  bank.attach(0, restored[0]);
+  bank.attach(1, restored[1]);
+  bank.setStore(&mStore);
+
+  EXPECT_TRUE(bank.restore());
+  EXPECT_EQ(restored[0].value(0), 5);
+  EXPECT_EQ(restored[1].value(15), 30);
+}
+}  // namespace mididmxbridge::unittest
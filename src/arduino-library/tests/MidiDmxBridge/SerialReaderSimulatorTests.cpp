@@ -0,0 +1,217 @@
+/**
+ * @file SerialReaderSimulatorTests.cpp
+ * @author Christian Neukam
+ * @brief Virtual-time simulation tests of the MIDI input throughput of the MidiDmxBridge
+ * @version 1.0
+ * @date 2024-03-14
+ *
+ * @copyright Copyright 2024 Christian Neukam. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "MidiDmxBridge.h"
+#include "SerialReaderSimulator.h"
+
+namespace mididmxbridge::unittest {
+static const uint8_t kChannel = 1; /**< the MIDI channel to test */
+
+/**
+ * @brief This class provides the fixture for the Test Suite, which simulates the MIDI traffic
+ * received by the MidiDmxBridge on a virtual clock.
+ *
+ */
+class BridgeSimulationTestSuite : public testing::Test {
+ public:
+  /**
+   * @brief Construct a new BridgeSimulationTestSuite object.
+   *
+   */
+  BridgeSimulationTestSuite()
+      : mSerial(),
+        mDmxCostUs(0),
+        mDut(
+            kChannel,
+            [this](const uint16_t channel, const uint8_t value) {
+              mSerial.advance(mDmxCostUs);  // the time the DMX output takes
+              mSerial.delivered(channel, value);
+            },
+            mSerial) {
+    mDut.begin();
+  }
+
+ protected:
+  /**
+   * @brief Schedule MIDI CC messages with running status cycling through some controllers.
+   *
+   * The values of each controller change with every message, i.e. every message changes a DMX
+   * value.
+   *
+   * @param[in] messages the number of MIDI CC messages
+   * @param[in] controllers the number of different controllers
+   * @param[in] interval_us the interval between the messages in µs, 0 for back-to-back messages
+   */
+  void schedule(const uint32_t messages, const uint8_t controllers, const uint32_t interval_us) {
+    for (uint32_t msg = 0; msg < messages; msg++) {
+      mSerial.sendCc(msg * interval_us, kChannel, (uint8_t)(1 + msg % controllers),
+                     (uint8_t)(msg / controllers + 1), msg > 0);
+    }
+  }
+
+  SerialReaderSimulator mSerial; /**< the simulated serial interface */
+  uint32_t mDmxCostUs;           /**< the simulated duration of a DMX callback in µs */
+  MidiDmxBridge mDut;            /**< the device under test */
+};
+
+/**
+ * @brief This test case checks whether the bytes arrive at the MIDI baud rate.
+ *
+ */
+TEST(SerialReaderSimulatorTestSuite, bytes_arrive_at_midi_baud_rate) {
+  SerialReaderSimulator serial;
+
+  EXPECT_EQ(serial.send(0, {0xb0, 0x01, 0x02}), 3 * SerialReaderSimulator::kByteTimeUs);
+  EXPECT_EQ(serial.available(), 0);
+
+  serial.advance(SerialReaderSimulator::kByteTimeUs);
+  EXPECT_EQ(serial.available(), 1);
+  serial.advance(2 * SerialReaderSimulator::kByteTimeUs - 1);
+  EXPECT_EQ(serial.available(), 2);
+  serial.sleep(1);
+  EXPECT_EQ(serial.available(), 3);
+  EXPECT_EQ(serial.micros(), 3 * SerialReaderSimulator::kByteTimeUs - 1 + 1000);
+  EXPECT_EQ(serial.millis(), 1u);
+
+  EXPECT_EQ(serial.read(), 0xb0);
+  EXPECT_EQ(serial.read(), 0x01);
+  EXPECT_EQ(serial.read(), 0x02);
+  EXPECT_EQ(serial.read(), -1);
+  EXPECT_TRUE(serial.idle());
+}
+
+/**
+ * @brief This test case checks whether bytes arriving at a full RX buffer are dropped and reported
+ * once via overflow().
+ *
+ */
+TEST(SerialReaderSimulatorTestSuite, full_rx_buffer_drops_bytes) {
+  SerialReaderSimulator serial(4);
+  uint8_t data[8] = {};
+
+  serial.send(0, {1, 2, 3, 4, 5, 6});
+  serial.advance(6 * SerialReaderSimulator::kByteTimeUs);
+
+  EXPECT_EQ(serial.report().sentBytes, 6u);
+  EXPECT_EQ(serial.report().droppedBytes, 2u);
+  EXPECT_TRUE(serial.overflow());
+  EXPECT_FALSE(serial.overflow());
+  ASSERT_EQ(serial.readBytes(data, sizeof(data)), 4u);
+  EXPECT_EQ(data[0], 1);
+  EXPECT_EQ(data[3], 4);
+}
+
+/**
+ * @brief This test case checks whether the latency is measured from the send time and superseded
+ * messages are not counted as delivered.
+ *
+ */
+TEST(SerialReaderSimulatorTestSuite, delivered_measures_latency) {
+  SerialReaderSimulator serial;
+
+  serial.sendCc(100, kChannel, 7, 1);
+  serial.sendCc(100, kChannel, 7, 2, true);
+  serial.advance(5000);
+  serial.delivered(7, 4);
+  serial.delivered(7, 2);
+  serial.delivered(8, 2);
+
+  ASSERT_EQ(serial.report().sentMessages, 2u);
+  ASSERT_EQ(serial.report().deliveredMessages, 1u);
+  EXPECT_EQ(serial.report().latencies[0], 4900u);
+  EXPECT_EQ(serial.report().maxLatencyUs, 4900u);
+}
+
+/**
+ * @brief This test case checks whether listen() keeps up with a moderate MIDI density, i.e. no
+ * bytes are dropped and every message is output within the idle sleep and its transmission time.
+ *
+ */
+TEST_F(BridgeSimulationTestSuite, listen_keeps_up_with_moderate_density) {
+  mDmxCostUs = 100;
+  schedule(500, 8, 2000);
+
+  mSerial.run(1100000, 50, [this]() { mDut.listen(); });
+
+  EXPECT_TRUE(mSerial.idle());
+  EXPECT_EQ(mSerial.report().droppedBytes, 0u);
+  EXPECT_EQ(mSerial.report().deliveredMessages, 500u);
+  EXPECT_LE(mSerial.report().maxLatencyUs,
+            3 * SerialReaderSimulator::kByteTimeUs + kDefaultIdleSleepMs * 1000 + 1000);
+}
+
+/**
+ * @brief This test case checks whether the idle sleep woken up by received data bounds the latency
+ * by the transmission time of a message instead of the idle sleep time.
+ *
+ */
+TEST_F(BridgeSimulationTestSuite, listen_with_idle_wake_minimizes_latency) {
+  mDmxCostUs = 100;
+  mSerial.setIdleWake(true);
+  schedule(500, 8, 2000);
+
+  mSerial.run(1100000, 50, [this]() { mDut.listen(); });
+
+  EXPECT_TRUE(mSerial.idle());
+  EXPECT_EQ(mSerial.report().droppedBytes, 0u);
+  EXPECT_EQ(mSerial.report().deliveredMessages, 500u);
+  EXPECT_LE(mSerial.report().maxLatencyUs, 3 * SerialReaderSimulator::kByteTimeUs + 1000);
+}
+
+/**
+ * @brief This test case checks whether a slow DMX output on a saturated MIDI line overflows the RX
+ * buffer and whether the overflow is counted by the statistics.
+ *
+ */
+TEST_F(BridgeSimulationTestSuite, slow_output_on_saturated_line_drops_bytes) {
+  mDmxCostUs = 1000;
+  schedule(2000, 8, 0);
+
+  mSerial.run(2000000, 50, [this]() { mDut.listen(); });
+
+  EXPECT_TRUE(mSerial.idle());
+  EXPECT_GT(mSerial.report().droppedBytes, 0u);
+  EXPECT_LT(mSerial.report().deliveredMessages, 2000u);
+#if MIDIDMXBRIDGE_STATS
+  EXPECT_GT(mDut.stats().overflows, 0u);
+#endif
+}
+
+/**
+ * @brief This test case checks whether coalescing the MIDI CC messages of a few controllers keeps
+ * up with a saturated MIDI line despite a slow DMX output.
+ *
+ */
+TEST_F(BridgeSimulationTestSuite, coalescing_keeps_up_on_saturated_line) {
+  mDmxCostUs = 1000;
+  mDut.setCoalescing(true);
+  schedule(2000, 2, 0);
+
+  mSerial.run(2000000, 50, [this]() { mDut.listen(); });
+
+  EXPECT_TRUE(mSerial.idle());
+  EXPECT_EQ(mSerial.report().droppedBytes, 0u);
+  EXPECT_GT(mSerial.report().deliveredMessages, 0u);
+}
+}  // namespace mididmxbridge::unittest
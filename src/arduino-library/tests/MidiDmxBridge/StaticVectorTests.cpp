@@ -0,0 +1,145 @@
+/**
+ * @file StaticVectorTests.cpp
+ * @author Christian Neukam
+ * @brief Unit Tests for the mididmxbridge::static_vector class template.
+ * @version 1.0
+ * @date 2024-02-25
+ *
+ * @copyright Copyright 2024 Christian Neukam. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <type_traits>
+
+#include "static_vector.h"
+
+namespace mididmxbridge::unittest {
+using mididmxbridge::static_vector;
+
+/**
+ * @brief This test case tests whether the default constructor of mididmxbridge::static_vector
+ * creates an empty container with the compile-time capacity.
+ *
+ */
+TEST(StaticVectorTestSuite, construct_empty) {
+  static_vector<int, 4> vec;
+
+  static_assert(static_vector<int, 4>::capacity() == 4, "capacity shall be constexpr");
+  static_assert(static_vector<int, 4>::max_size() == 4, "max_size shall be constexpr");
+  EXPECT_EQ(vec.size(), 0);
+  EXPECT_TRUE(vec.empty());
+  EXPECT_FALSE(vec.full());
+}
+
+/**
+ * @brief This test case tests whether the elements of mididmxbridge::static_vector are stored in
+ * place without any further allocation.
+ *
+ */
+TEST(StaticVectorTestSuite, elements_are_stored_in_place) {
+  EXPECT_EQ(sizeof(static_vector<uint8_t, 8>), 8u + 1u);
+}
+
+/**
+ * @brief This test case tests whether the constructor of mididmxbridge::static_vector clips the
+ * requested size to the capacity.
+ *
+ */
+TEST(StaticVectorTestSuite, construct_by_size_greater_than_capacity) {
+  static_vector<int, 4> vec(5);
+
+  EXPECT_EQ(vec.size(), 4);
+  EXPECT_TRUE(vec.full());
+  EXPECT_EQ(vec[3], 0);
+}
+
+/**
+ * @brief This test case tests whether the constructor of mididmxbridge::static_vector creates a
+ * container with the provided value array and discards the values exceeding the capacity.
+ *
+ */
+TEST(StaticVectorTestSuite, construct_by_value) {
+  const int values[] = {1, 2, 3};
+  static_vector<int, 2> vec(3, values);
+
+  EXPECT_EQ(vec.size(), 2);
+  EXPECT_EQ(vec[0], 1);
+  EXPECT_EQ(vec[1], 2);
+}
+
+/**
+ * @brief This test case tests whether mididmxbridge::static_vector::push_back() discards values
+ * once the container is full.
+ *
+ */
+TEST(StaticVectorTestSuite, push_back_discards_values_if_full) {
+  static_vector<int, 2> vec;
+
+  vec.push_back(1);
+  vec.push_back(2);
+  vec.push_back(3);
+
+  EXPECT_EQ(vec.size(), 2);
+  EXPECT_EQ(vec[1], 2);
+}
+
+/**
+ * @brief This test case tests whether mididmxbridge::static_vector::pop_back() and
+ * mididmxbridge::static_vector::clear() remove the elements of the container.
+ *
+ */
+TEST(StaticVectorTestSuite, pop_back_and_clear_remove_elements) {
+  static_vector<int, 4> vec(3);
+
+  vec.pop_back();
+  EXPECT_EQ(vec.size(), 2);
+
+  vec.clear();
+  EXPECT_TRUE(vec.empty());
+
+  vec.pop_back();
+  EXPECT_TRUE(vec.empty());
+}
+
+/**
+ * @brief This test case tests whether the array constructor of mididmxbridge::static_vector copies
+ * all values and whether a size cannot be converted to a container implicitly.
+ *
+ */
+TEST(StaticVectorTestSuite, construct_by_array) {
+  static_vector<int, 3> vec({1, 2, 3});
+
+  static_assert(!std::is_convertible<uint8_t, static_vector<int, 3>>::value,
+                "a size shall not convert to a container implicitly");
+  EXPECT_EQ(vec.size(), 3);
+  EXPECT_TRUE(vec.full());
+  EXPECT_EQ(vec[2], 3);
+}
+
+/**
+ * @brief This test case tests whether mididmxbridge::static_vector::push_back() reports the values
+ * it discards because the container overflows.
+ *
+ */
+TEST(StaticVectorTestSuite, push_back_reports_overflow) {
+  static_vector<int, 2> vec;
+
+  EXPECT_TRUE(vec.push_back(1));
+  EXPECT_TRUE(vec.push_back(2));
+  EXPECT_FALSE(vec.push_back(3));
+  EXPECT_EQ(vec.size(), 2);
+}
+}  // namespace mididmxbridge::unittest
@@ -0,0 +1,187 @@
+/**
+ * @file TraceRingTests.cpp
+ * @author Christian Neukam
+ * @brief Unit tests of the binary trace facility of the MidiDmxBridge library.
+ * @version 1.0
+ * @date 2024-03-10
+ *
+ * @copyright Copyright 2024 Christian Neukam. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "TraceRing.h"
+
+namespace mididmxbridge::unittest {
+using mididmxbridge::decodeTraceRecord;
+using mididmxbridge::kTraceRecordSize;
+using mididmxbridge::TraceRecord;
+using mididmxbridge::TraceRing;
+using mididmxbridge::TraceStreamDecoder;
+
+/**
+ * @brief This class simulates an output with a limited transmit buffer like the Arduino Serial API.
+ *
+ */
+class OutputFake {
+ public:
+  /**
+   * @brief Construct a new OutputFake object.
+   *
+   * @param[in] room the number of bytes the output accepts without blocking
+   */
+  OutputFake(const int room) : mRoom(room), mData() {}
+
+  int availableForWrite() const { return mRoom; }
+
+  size_t write(const uint8_t* data, const size_t size) {
+    mData.insert(mData.end(), data, data + size);
+    return size;
+  }
+
+  /**
+   * @brief Get the bytes written to the output.
+   *
+   * @return const std::vector<uint8_t>& - the written bytes
+   */
+  const std::vector<uint8_t>& data() const { return mData; }
+
+ private:
+  const int mRoom;            /**< the bytes accepted without blocking */
+  std::vector<uint8_t> mData; /**< the written bytes */
+};
+
+/**
+ * @brief This test case tests whether a record drained from a mididmxbridge::TraceRing is decoded
+ * by mididmxbridge::decodeTraceRecord() with the recorded timestamp, channel and value.
+ *
+ */
+TEST(TraceRingTestSuite, record_drain_decode_roundtrip) {
+  TraceRing<32> dut;
+  OutputFake out(64);
+  TraceRecord record = {0, 0, 0};
+
+  EXPECT_TRUE(dut.record(0x12345678, 0x0201, 0xfe));
+  EXPECT_EQ(dut.size(), 1);
+  EXPECT_EQ(dut.drain(out), kTraceRecordSize);
+  EXPECT_TRUE(dut.empty());
+
+  ASSERT_EQ(out.data().size(), kTraceRecordSize);
+  ASSERT_TRUE(decodeTraceRecord(out.data().data(), record));
+  EXPECT_EQ(record.time_ms, 0x12345678);
+  EXPECT_EQ(record.channel, 0x0201);
+  EXPECT_EQ(record.value, 0xfe);
+}
+
+/**
+ * @brief This test case tests whether mididmxbridge::TraceRing::record() discards and counts
+ * records exceeding the capacity of the ring buffer.
+ *
+ */
+TEST(TraceRingTestSuite, record_full_shall_drop) {
+  TraceRing<32> dut;  // 31 bytes hold 3 records
+
+  EXPECT_TRUE(dut.record(1, 1, 1));
+  EXPECT_TRUE(dut.record(2, 2, 2));
+  EXPECT_TRUE(dut.record(3, 3, 3));
+  EXPECT_FALSE(dut.record(4, 4, 4));
+  EXPECT_EQ(dut.size(), 3);
+  EXPECT_EQ(dut.dropped(), 1);
+}
+
+/**
+ * @brief This test case tests whether mididmxbridge::TraceRing::drain() only writes complete
+ * records that fit into the transmit buffer of the output.
+ *
+ */
+TEST(TraceRingTestSuite, drain_shall_not_block) {
+  TraceRing<64> dut;
+  OutputFake full(kTraceRecordSize - 1);
+  OutputFake partial(2 * kTraceRecordSize + 1);
+
+  for (uint8_t idx = 0; idx < 5; idx++) {
+    dut.record(idx, idx, idx);
+  }
+
+  EXPECT_EQ(dut.drain(full), 0);
+  EXPECT_EQ(dut.drain(partial), 2 * kTraceRecordSize);
+  EXPECT_EQ(dut.size(), 3);
+}
+
+/**
+ * @brief This test case tests whether the records stay intact when the ring buffer wraps around.
+ *
+ */
+TEST(TraceRingTestSuite, drain_wraparound_shall_keep_records) {
+  TraceRing<16> dut;  // 15 bytes hold a single record
+  TraceRecord record = {0, 0, 0};
+
+  for (uint16_t idx = 0; idx < 5; idx++) {
+    OutputFake out(kTraceRecordSize);
+
+    EXPECT_TRUE(dut.record(1000 + idx, 500 + idx, (uint8_t)idx));
+    EXPECT_EQ(dut.drain(out), kTraceRecordSize);
+    ASSERT_TRUE(decodeTraceRecord(out.data().data(), record));
+    EXPECT_EQ(record.time_ms, 1000 + idx);
+    EXPECT_EQ(record.channel, 500 + idx);
+    EXPECT_EQ(record.value, idx);
+  }
+}
+
+/**
+ * @brief This test case tests whether mididmxbridge::decodeTraceRecord() rejects data not starting
+ * with the sync byte.
+ *
+ */
+TEST(TraceRingTestSuite, decode_without_sync_shall_fail) {
+  const uint8_t data[kTraceRecordSize] = {0x00, 0xa5, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06};
+  TraceRecord record = {0, 0, 0};
+
+  EXPECT_FALSE(decodeTraceRecord(data, record));
+  EXPECT_EQ(record.time_ms, 0);
+}
+
+/**
+ * @brief This test case tests whether mididmxbridge::TraceStreamDecoder does not lock onto a sync
+ * byte in the payload of a record when the stream starts mid-record, and decodes all following
+ * records including the last one.
+ *
+ */
+TEST(TraceRingTestSuite, stream_started_mid_record_shall_not_false_lock) {
+  const std::vector<uint8_t> stream = {
+      0xa5, 0x00, 0x00, 0x05, 0x00, 0x10,               // the rest of a record with the time 0xa500
+      0xa5, 0x01, 0x02, 0x00, 0x00, 0x06, 0x00, 0x20,   // time 0x0201, channel 6, value 0x20
+      0xa5, 0x03, 0x04, 0x00, 0x00, 0x07, 0x00, 0x30,   // time 0x0403, channel 7, value 0x30
+      0xa5, 0x05, 0x06, 0x00, 0x00, 0x08, 0x00, 0x40};  // time 0x0605, channel 8, value 0x40
+  TraceStreamDecoder dut;
+  TraceRecord record = {0, 0, 0};
+  std::vector<uint16_t> channels;
+
+  for (const uint8_t byte : stream) {
+    if (dut.decode(byte, record)) {
+      channels.push_back(record.channel);
+      EXPECT_EQ(record.value, (record.channel - 4) << 4);
+    }
+  }
+  if (dut.finish(record)) {
+    channels.push_back(record.channel);
+    EXPECT_EQ(record.time_ms, 0x0605);
+  }
+
+  EXPECT_THAT(channels, testing::ElementsAre(6, 7, 8));
+}
+}  // namespace mididmxbridge::unittest
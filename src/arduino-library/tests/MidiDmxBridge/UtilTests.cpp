@@ -23,6 +23,7 @@
 #include <gtest/gtest.h>
 
 #include <algorithm>
+#include <cmath>
 
 #include "util.h"
 
@@ -70,4 +71,35 @@ TEST(UtilTestSuite, absDiff_returns_absoluteDifference) {
   EXPECT_EQ(absDiff_t(b, a), std::abs(b - a));
   EXPECT_EQ(absDiff_t(a, a), 0);
 }
+
+/**
+ * @brief This test case tests whether the functions mididmxbridge::util::exp_t() and
+ * mididmxbridge::util::log_t() return the same results as std::exp() and std::log().
+ *
+ */
+TEST(UtilTestSuite, exp_log_equal_std_exp_log) {
+  static_assert(exp_t(0.0) == 1.0, "exp_t shall be usable at compile time");
+  static_assert(log_t(1.0) == 0.0, "log_t shall be usable at compile time");
+
+  for (double x = -8.0; x <= 8.0; x += 0.25) {
+    EXPECT_NEAR(exp_t(x), std::exp(x), std::exp(x) * 1e-12);
+  }
+  for (double x = 0.001; x <= 1000.0; x *= 1.5) {
+    EXPECT_NEAR(log_t(x), std::log(x), 1e-12);
+  }
+}
+
+/**
+ * @brief This test case tests whether the function mididmxbridge::util::pow_t() returns the same
+ * result as std::pow() in the range of the response curves.
+ *
+ */
+TEST(UtilTestSuite, pow_equals_std_pow) {
+  for (uint8_t idx = 0; idx < 128; idx++) {
+    const double x = idx / 127.0;
+
+    EXPECT_NEAR(pow_t(x, 2.2), std::pow(x, 2.2), 1e-12);
+    EXPECT_NEAR(pow_t(x, 1.0 / 2.2), std::pow(x, 1.0 / 2.2), 1e-12);
+  }
+}
 }  // namespace mididmxbridge::unittest
@@ -0,0 +1,91 @@
+/**
+ * @file SceneStoreFake.h
+ * @author Christian Neukam
+ * @brief Fake implementation of the mididmxbridge::ISceneStore interface
+ * @version 1.0
+ * @date 2024-03-12
+ *
+ * @copyright Copyright 2024 Christian Neukam. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+#include <cstdint>
+#include <vector>
+
+#include "ISceneStore.h"
+
+namespace mididmxbridge::unittest {
+/**
+ * @brief This class simulates an erased EEPROM implementing the mididmxbridge::ISceneStore
+ * interface.
+ *
+ */
+class SceneStoreFake : public mididmxbridge::ISceneStore {
+ public:
+  /**
+   * @brief Construct a new SceneStoreFake object with all bytes erased to 0xff.
+   *
+   * @param[in] size the size of the memory in bytes
+   */
+  SceneStoreFake(const uint16_t size) : mData(size, 0xff), mWrites(0), mReads(0) {}
+
+  uint16_t length() override { return (uint16_t)mData.size(); }
+
+  uint8_t read(const uint16_t address) override { return mData.at(address); }
+
+  void readBytes(const uint16_t address, uint8_t* dst, const uint16_t size) override {
+    for (uint16_t idx = 0; idx < size; idx++) {
+      dst[idx] = mData.at(address + idx);
+    }
+    mReads++;
+  }
+
+  bool update(const uint16_t address, const uint8_t value) override {
+    const bool returnValue = (mData.at(address) != value);
+
+    if (returnValue) {
+      mData.at(address) = value;
+      mWrites++;
+    }
+
+    return returnValue;
+  }
+
+  /**
+   * @brief Get the content of the memory.
+   *
+   * @return std::vector<uint8_t>& - the bytes of the memory
+   */
+  std::vector<uint8_t>& data() { return mData; }
+
+  /**
+   * @brief Get the number of bytes written, i.e. the EEPROM wear.
+   *
+   * @return size_t - the number of written bytes
+   */
+  size_t writes() const { return mWrites; }
+
+  /**
+   * @brief Get the number of readBytes() calls.
+   *
+   * @return size_t - the number of sequential reads
+   */
+  size_t reads() const { return mReads; }
+
+ private:
+  std::vector<uint8_t> mData; /**< the content of the memory */
+  size_t mWrites;             /**< the number of written bytes */
+  size_t mReads;              /**< the number of readBytes() calls */
+};
+}  // namespace mididmxbridge::unittest
@@ -21,6 +21,8 @@
  */
 #include "SerialReaderMock.h"
 
+#include <algorithm>
+
 namespace mididmxbridge::unittest {
 
 SerialReaderMock::SerialReaderMock(const std::vector<uint8_t>& data) : mSerialData(data) {
@@ -42,6 +44,19 @@ SerialReaderMock::SerialReaderMock(const std::vector<uint8_t>& data) : mSerialDa
 
     return returnValue;
   });
+
+  ON_CALL(*this, readBytes).WillByDefault([&](uint8_t* dst, const size_t max) {
+    const size_t count = std::min(max, mSerialData.size());
+
+    std::copy(mSerialData.begin(), mSerialData.begin() + count, dst);
+    mSerialData.erase(mSerialData.begin(), mSerialData.begin() + count);
+
+    return count;
+  });
+}
+
+void SerialReaderMock::append(const std::vector<uint8_t>& data) {
+  mSerialData.insert(mSerialData.end(), data.begin(), data.end());
 }
 
 }  // namespace mididmxbridge::unittest
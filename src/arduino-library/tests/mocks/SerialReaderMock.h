@@ -48,9 +48,20 @@ class SerialReaderMock : public mididmxbridge::ISerialReader {
   MOCK_METHOD(void, begin, (), (override));
   MOCK_METHOD(int, available, (), (override));
   MOCK_METHOD(int, read, (), (override));
+  MOCK_METHOD(size_t, readBytes, (uint8_t * dst, const size_t max), (override));
   MOCK_METHOD(void, sleep, (uint16_t sleep_ms), (override));
+  MOCK_METHOD(uint32_t, millis, (), (override));
+  MOCK_METHOD(uint32_t, micros, (), (override));
+  MOCK_METHOD(bool, overflow, (), (override));
   ///@}
 
+  /**
+   * @brief Append data to the simulated serial data buffer, e.g. to simulate delayed reception.
+   *
+   * @param[in] data the serial data to append
+   */
+  void append(const std::vector<uint8_t>& data);
+
  private:
   std::vector<uint8_t> mSerialData; /**< the serial data to simulate */
 };
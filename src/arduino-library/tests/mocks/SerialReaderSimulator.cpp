@@ -0,0 +1,146 @@
+/**
+ * @file SerialReaderMock.h
+ * @author Christian Neukam
+ * @brief Virtual-time simulation of the mididmxbridge::ISerialReader interface
+ * @version 1.0
+ * @date 2024-03-14
+ *
+ * @copyright Copyright 2024 Christian Neukam. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "SerialReaderSimulator.h"
+
+#include <algorithm>
+
+#include "IdleSleep.h"
+
+namespace mididmxbridge::unittest {
+
+SerialReaderSimulator::SerialReaderSimulator(const size_t rxBufferSize)
+    : mRxBufferSize(rxBufferSize),
+      mWire(),
+      mRxBuffer(),
+      mPending(),
+      mNowUs(0),
+      mWireFreeUs(0),
+      mOverflow(false),
+      mIsIdleWake(false),
+      mReport() {}
+
+int SerialReaderSimulator::read() {
+  int returnValue = -1;  // return -1 if no data is available
+
+  if (!mRxBuffer.empty()) {
+    returnValue = mRxBuffer.front();
+    mRxBuffer.pop_front();
+  }
+
+  return returnValue;
+}
+
+size_t SerialReaderSimulator::readBytes(uint8_t* dst, const size_t max) {
+  const size_t count = std::min(max, mRxBuffer.size());
+
+  std::copy(mRxBuffer.begin(), mRxBuffer.begin() + count, dst);
+  mRxBuffer.erase(mRxBuffer.begin(), mRxBuffer.begin() + count);
+
+  return count;
+}
+
+bool SerialReaderSimulator::overflow() {
+  const bool returnValue = mOverflow;
+
+  mOverflow = false;  // SoftwareSerial clears the flag once it is read
+
+  return returnValue;
+}
+
+void SerialReaderSimulator::sleep(uint16_t sleep_ms) {
+  if (mIsIdleWake) {
+    idleWait(*this, sleep_ms, [this]() {
+      const uint32_t tick_us = kTimerTickUs - (mNowUs % kTimerTickUs);
+      const uint32_t arrival_us = mWire.empty() ? tick_us : (mWire.front().arrivalUs - mNowUs);
+
+      advance(std::min(tick_us, arrival_us));  // wake up on the next interrupt
+    });
+  } else {
+    advance((uint32_t)sleep_ms * 1000);
+  }
+}
+
+uint32_t SerialReaderSimulator::send(const uint32_t at_us, const std::vector<uint8_t>& data) {
+  mWireFreeUs = std::max(mWireFreeUs, at_us);
+
+  for (const uint8_t byte : data) {
+    mWireFreeUs += kByteTimeUs;
+    mWire.push_back({mWireFreeUs, byte});
+  }
+  mReport.sentBytes += (uint32_t)data.size();
+  advance(0);  // receive the bytes scheduled in the past
+
+  return mWireFreeUs;
+}
+
+uint32_t SerialReaderSimulator::sendCc(const uint32_t at_us, const uint8_t channel,
+                                       const uint8_t controller, const uint8_t value,
+                                       const bool runningStatus) {
+  std::vector<uint8_t> data;
+
+  if (!runningStatus) {
+    data.push_back((uint8_t)(0xb0 | ((channel - 1) & 0x0f)));
+  }
+  data.push_back(controller & 0x7f);
+  data.push_back(value & 0x7f);
+
+  mPending[controller & 0x7f].push_back({(uint8_t)(value & 0x7f), at_us});
+  mReport.sentMessages++;
+
+  return send(at_us, data);
+}
+
+void SerialReaderSimulator::delivered(const uint16_t channel, const uint8_t value) {
+  const auto pending = mPending.find((uint8_t)channel);
+
+  if (pending != mPending.end()) {
+    std::deque<PendingCc>& queue = pending->second;
+    const auto match = std::find_if(queue.begin(), queue.end(), [value](const PendingCc& cc) {
+      return (cc.value << 1) == value;
+    });
+
+    if (match != queue.end()) {
+      const uint32_t latency_us = mNowUs - match->sentUs;
+
+      mReport.deliveredMessages++;
+      mReport.maxLatencyUs = std::max(mReport.maxLatencyUs, latency_us);
+      mReport.latencies.push_back(latency_us);
+      queue.erase(queue.begin(), match + 1);  // the skipped values got superseded
+    }
+  }
+}
+
+void SerialReaderSimulator::advance(const uint32_t us) {
+  mNowUs += us;
+
+  while (!mWire.empty() && (mWire.front().arrivalUs <= mNowUs)) {
+    if (mRxBuffer.size() < mRxBufferSize) {
+      mRxBuffer.push_back(mWire.front().data);
+    } else {
+      mReport.droppedBytes++;  // SoftwareSerial discards the byte received into a full buffer
+      mOverflow = true;
+    }
+    mWire.pop_front();
+  }
+}
+
+}  // namespace mididmxbridge::unittest
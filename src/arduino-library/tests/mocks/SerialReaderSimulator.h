@@ -0,0 +1,194 @@
+/**
+ * @file SerialReaderSimulator.h
+ * @author Christian Neukam
+ * @brief Virtual-time simulation of the mididmxbridge::ISerialReader interface
+ * @version 1.0
+ * @date 2024-03-14
+ *
+ * @copyright Copyright 2024 Christian Neukam. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+#include <cstdint>
+#include <deque>
+#include <map>
+#include <vector>
+
+#include "ISerialReader.h"
+
+namespace mididmxbridge::unittest {
+/**
+ * @brief This struct holds the results of a simulation run.
+ *
+ */
+struct SimulationReport {
+  uint32_t sentMessages;           /**< the number of MIDI messages sent via sendCc() */
+  uint32_t deliveredMessages;      /**< the number of MIDI messages output as DMX value */
+  uint32_t sentBytes;              /**< the number of bytes transmitted on the MIDI line */
+  uint32_t droppedBytes;           /**< the number of bytes lost due to a full RX buffer */
+  uint32_t maxLatencyUs;           /**< the longest end-to-end latency in µs */
+  std::vector<uint32_t> latencies; /**< the end-to-end latency per delivered message in µs */
+};
+
+/**
+ * @brief This class simulates a serial MIDI interface on a virtual clock.
+ *
+ * Scheduled bytes arrive at the MIDI baud rate of 31250 baud, i.e. every 320 µs, and are stored in
+ * a finite RX buffer like the one of SoftwareSerial. Bytes arriving while the buffer is full are
+ * dropped and reported via overflow(). The virtual clock only advances via sleep() and advance(),
+ * e.g. from the DMX callback to model the time spent on the DMX output. sleep() either models a
+ * delay or the idle sleep woken up by received data, see setIdleWake().
+ *
+ * The end-to-end latency is measured from the scheduled send time of a MIDI CC message until its
+ * DMX value is reported via delivered(). A message is only delivered if its value differs from the
+ * previous value of the same controller, as the bridge suppresses unchanged DMX values.
+ *
+ */
+class SerialReaderSimulator final : public mididmxbridge::ISerialReader {
+ public:
+  static constexpr uint32_t kBaudRate = 31250;                  /**< the MIDI baud rate */
+  static constexpr uint32_t kByteTimeUs = 10000000 / kBaudRate; /**< start, 8 data, stop bit */
+  static constexpr size_t kDefaultRxBufferSize = 64;            /**< SoftwareSerial RX buffer */
+  static constexpr uint32_t kTimerTickUs = 1024;               /**< the millis() timer of AVR */
+
+  /**
+   * @brief Construct a new SerialReaderSimulator object.
+   *
+   * @param[in] rxBufferSize the capacity of the RX buffer in bytes
+   */
+  SerialReaderSimulator(const size_t rxBufferSize = kDefaultRxBufferSize);
+
+  void begin() override {}
+  int available() override { return (int)mRxBuffer.size(); }
+  int read() override;
+  size_t readBytes(uint8_t* dst, const size_t max) override;
+  bool overflow() override;
+  void sleep(uint16_t sleep_ms) override;
+  uint32_t millis() override { return mNowUs / 1000; }
+  uint32_t micros() override { return mNowUs; }
+
+  /**
+   * @brief Select whether sleep() models a delay or the idle sleep woken up by received data.
+   *
+   * In the idle mode, sleep() waits via mididmxbridge::idleWait() from one interrupt to the next,
+   * i.e. the arrival of a byte or the millis() timer tick of AVR boards.
+   *
+   * @param[in] enable true to wake up on received data, false to sleep for the whole time
+   */
+  void setIdleWake(const bool enable) { mIsIdleWake = enable; }
+
+  /**
+   * @brief Schedule raw bytes for transmission on the MIDI line.
+   *
+   * The transmission starts at \p at_us or once the previous bytes are sent, whichever is later.
+   * The bytes shall be scheduled in chronological order.
+   *
+   * @param[in] at_us the send time in µs
+   * @param[in] data the bytes to send
+   * @return uint32_t - the arrival time of the last byte in µs
+   */
+  uint32_t send(const uint32_t at_us, const std::vector<uint8_t>& data);
+
+  /**
+   * @brief Schedule a MIDI CC message for transmission and track its latency.
+   *
+   * @param[in] at_us the send time in µs
+   * @param[in] channel the MIDI channel in the range [1, 16]
+   * @param[in] controller the MIDI CC controller, i.e. the DMX channel
+   * @param[in] value the MIDI CC value
+   * @param[in] runningStatus true to omit the status byte
+   * @return uint32_t - the arrival time of the last byte in µs
+   */
+  uint32_t sendCc(const uint32_t at_us, const uint8_t channel, const uint8_t controller,
+                  const uint8_t value, const bool runningStatus = false);
+
+  /**
+   * @brief Report a DMX value output by the bridge, e.g. from the DMX callback.
+   *
+   * Pending messages of the same controller sent before the matching message are discarded, as
+   * their values got superseded.
+   *
+   * @param[in] channel the DMX channel
+   * @param[in] value the DMX value
+   */
+  void delivered(const uint16_t channel, const uint8_t value);
+
+  /**
+   * @brief Advance the virtual clock and receive the bytes arriving in the meantime.
+   *
+   * @param[in] us the time to advance in µs
+   */
+  void advance(const uint32_t us);
+
+  /**
+   * @brief Run a loop function until the virtual time is reached.
+   *
+   * @tparam Loop the type of the loop function, e.g. a lambda calling listen()
+   * @param[in] until_us the virtual time to stop at in µs
+   * @param[in] loopCostUs the CPU time of the remaining sketch per iteration in µs, at least 1
+   * @param[in] loop the loop function
+   */
+  template <class Loop>
+  void run(const uint32_t until_us, const uint32_t loopCostUs, Loop loop) {
+    while (mNowUs < until_us) {
+      loop();
+      advance((loopCostUs > 0) ? loopCostUs : 1);  // the virtual time must progress
+    }
+  }
+
+  /**
+   * @brief Check whether all scheduled bytes got received and read.
+   *
+   * @return true - neither the MIDI line nor the RX buffer hold any bytes
+   * @return false - otherwise
+   */
+  bool idle() const { return mWire.empty() && mRxBuffer.empty(); }
+
+  /**
+   * @brief Get the results of the simulation so far.
+   *
+   * @return const SimulationReport& - the simulation results
+   */
+  const SimulationReport& report() const { return mReport; }
+
+ private:
+  /**
+   * @brief This struct describes a byte on the MIDI line.
+   *
+   */
+  struct WireByte {
+    uint32_t arrivalUs; /**< the time the stop bit is received in µs */
+    uint8_t data;       /**< the value of the byte */
+  };
+
+  /**
+   * @brief This struct describes a MIDI CC message awaiting its DMX output.
+   *
+   */
+  struct PendingCc {
+    uint8_t value;   /**< the MIDI CC value */
+    uint32_t sentUs; /**< the scheduled send time in µs */
+  };
+
+  const size_t mRxBufferSize;                        /**< the capacity of the RX buffer */
+  std::deque<WireByte> mWire;                        /**< the bytes not yet received */
+  std::deque<uint8_t> mRxBuffer;                     /**< the received bytes */
+  std::map<uint8_t, std::deque<PendingCc>> mPending; /**< the pending messages per CC */
+  uint32_t mNowUs;                                   /**< the virtual time in µs */
+  uint32_t mWireFreeUs;                              /**< the end of the transmission in µs */
+  bool mOverflow;                                    /**< true if bytes got dropped */
+  bool mIsIdleWake;                                  /**< true if sleep() wakes up on data */
+  SimulationReport mReport;                          /**< the simulation results */
+};
+}  // namespace mididmxbridge::unittest
@@ -0,0 +1,81 @@
+/**
+ * @file TraceDecoder.cpp
+ * @author Christian Neukam
+ * @brief Host-side decoder of the binary trace written by mididmxbridge::TraceRing.
+ * @version 1.0
+ * @date 2024-03-10
+ *
+ * @copyright Copyright 2024 Christian Neukam. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <cstdio>
+
+#include "TraceRing.h"
+
+using mididmxbridge::TraceRecord;
+using mididmxbridge::TraceStreamDecoder;
+
+/**
+ * @brief Print a decoded record as one line.
+ *
+ * @param[in] record the decoded record
+ */
+static void printRecord(const TraceRecord& record) {
+  std::printf("%u\t%u\t%u\n", (unsigned)record.time_ms, (unsigned)record.channel,
+              (unsigned)record.value);
+}
+
+/**
+ * @brief Decode a binary trace and print one line per DMX change.
+ *
+ * The trace is read from the file given as first argument or from stdin, e.g. a capture of the
+ * serial port via \p cat /dev/ttyACM0 | tracedecoder. Bytes not belonging to a record, e.g. after
+ * connecting to a running board, are skipped until two consecutive records are found, see
+ * mididmxbridge::TraceStreamDecoder.
+ *
+ * @param[in] argc the number of arguments
+ * @param[in] argv the arguments, argv[1] is the optional trace file
+ * @return int - 0 on success, 1 if the trace file cannot be opened
+ */
+int main(int argc, char* argv[]) {
+  FILE* in = (argc > 1) ? std::fopen(argv[1], "rb") : stdin;
+  int returnValue = 0;
+
+  if (nullptr == in) {
+    std::fprintf(stderr, "cannot open %s\n", argv[1]);
+    returnValue = 1;
+  } else {
+    TraceStreamDecoder decoder;
+    TraceRecord record;
+    int byte;
+
+    std::printf("time_ms\tchannel\tvalue\n");
+
+    while (EOF != (byte = std::fgetc(in))) {
+      if (decoder.decode((uint8_t)byte, record)) {
+        printRecord(record);
+      }
+    }
+
+    if (decoder.finish(record)) {
+      printRecord(record);
+    }
+
+    if (stdin != in) {
+      std::fclose(in);
+    }
+  }
+
+  return returnValue;
+}